@@ -16,6 +16,7 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 #include <testbench/main.tests.hpp>
 
+#include <testbench/benchmark.tests.hpp>
 #include <testbench/comparison.tests.hpp>
 #include <testbench/data.tests.hpp>
 #include <testbench/optimise.tests.hpp>
@@ -24,6 +25,41 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 #include <container/any>
 
+#if defined(_MSC_VER)
+#pragma warning(push, 0)
+#endif
+
+#include <cstdlib>
+#include <new>
+#include <string>
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+
+namespace {
+    unsigned long long int allocation_count = 0;
+}
+
+// Count heap allocations made by the test so the inline storage of any can be verified.
+void* operator new(std::size_t size) {
+    ++allocation_count;
+    void* pointer = std::malloc(size ? size : 1);
+    if (!pointer) {
+        std::abort();
+    }
+    return pointer;
+}
+
+void operator delete(void* pointer) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t size) noexcept {
+    static_cast<void>(size);
+    std::free(pointer);
+}
+
 TEST(any, constructor, empty) {
     gtl::any any;
     testbench::do_not_optimise_away(any);
@@ -46,3 +82,128 @@ TEST(any, evaluate, any) {
     any = string;
     REQUIRE(testbench::is_string_same(static_cast<const char*>(any), string) == true, "gtl::any = '%s', expected '%s'", static_cast<char*>(any), string);
 }
+
+TEST(any, evaluate, type) {
+    gtl::any any;
+    REQUIRE(!any.has_value());
+    REQUIRE(!any.is_type<int>());
+    REQUIRE(any.get<int>() == nullptr);
+
+    any = 1;
+    REQUIRE(any.has_value());
+    REQUIRE(any.is_type<int>());
+    REQUIRE(!any.is_type<unsigned int>());
+    REQUIRE(!any.is_type<double>());
+    REQUIRE(*any.get<int>() == 1);
+    REQUIRE(any.get<float>() == nullptr);
+    REQUIRE(static_cast<float>(any) == 0.0f);
+
+    any.reset();
+    REQUIRE(!any.has_value());
+}
+
+TEST(any, evaluate, storage) {
+    struct small_type {
+        int values[4];
+    };
+
+    struct large_type {
+        int values[64];
+    };
+
+    REQUIRE(gtl::any::stores_inline<int>());
+    REQUIRE(gtl::any::stores_inline<small_type>());
+    REQUIRE(gtl::any::stores_inline<std::string>() == (sizeof(std::string) <= gtl::any::buffer_size));
+    REQUIRE(!gtl::any::stores_inline<large_type>());
+
+    const unsigned long long int allocations_start = allocation_count;
+    {
+        gtl::any any(small_type{ { 1, 2, 3, 4 } });
+        gtl::any copy(any);
+        gtl::any moved(static_cast<gtl::any&&>(copy));
+        any = 123;
+        any = 4.56;
+        REQUIRE(moved.get<small_type>()->values[3] == 4);
+        REQUIRE(!copy.has_value());
+    }
+    REQUIRE(allocation_count == allocations_start, "Expected no allocations for inline values, got %llu.", allocation_count - allocations_start);
+
+    {
+        large_type large = {};
+        large.values[63] = 63;
+        gtl::any any(large);
+        REQUIRE(allocation_count == allocations_start + 1);
+        gtl::any moved(static_cast<gtl::any&&>(any));
+        REQUIRE(allocation_count == allocations_start + 1, "Expected moving a heap value to transfer the pointer.");
+        gtl::any copy(moved);
+        REQUIRE(allocation_count == allocations_start + 2);
+        REQUIRE(copy.get<large_type>()->values[63] == 63);
+        REQUIRE(moved.get<large_type>() != copy.get<large_type>());
+    }
+
+    {
+        std::string text = "A string long enough to need its own allocation.";
+        gtl::any any(text);
+        gtl::any copy(any);
+        gtl::any moved(static_cast<gtl::any&&>(any));
+        REQUIRE(*copy.get<std::string>() == text);
+        REQUIRE(*moved.get<std::string>() == text);
+        REQUIRE(!any.has_value());
+        copy = *copy.get<std::string>();
+        REQUIRE(*copy.get<std::string>() == text);
+    }
+}
+
+TEST(any, evaluate, benchmark) {
+    struct small_type {
+        int values[4];
+    };
+
+    struct large_type {
+        int values[64];
+    };
+
+    constexpr static const unsigned long long int iterations = 100000;
+
+    unsigned long long int allocations_start = allocation_count;
+    PRINT("Copy small:  %f\n", testbench::benchmark([]() {
+              gtl::any any(small_type{ { 1, 2, 3, 4 } });
+              for (unsigned long long int iteration = 0; iteration < iterations; ++iteration) {
+                  gtl::any copy(any);
+                  testbench::do_not_optimise_away(copy);
+              }
+          }));
+    PRINT("Allocations: %llu\n", allocation_count - allocations_start);
+
+    allocations_start = allocation_count;
+    PRINT("Move small:  %f\n", testbench::benchmark([]() {
+              gtl::any any(small_type{ { 1, 2, 3, 4 } });
+              for (unsigned long long int iteration = 0; iteration < iterations; ++iteration) {
+                  gtl::any moved(static_cast<gtl::any&&>(any));
+                  any = static_cast<gtl::any&&>(moved);
+              }
+              testbench::do_not_optimise_away(any);
+          }));
+    PRINT("Allocations: %llu\n", allocation_count - allocations_start);
+
+    allocations_start = allocation_count;
+    PRINT("Copy large:  %f\n", testbench::benchmark([]() {
+              gtl::any any(large_type{});
+              for (unsigned long long int iteration = 0; iteration < iterations; ++iteration) {
+                  gtl::any copy(any);
+                  testbench::do_not_optimise_away(copy);
+              }
+          }));
+    PRINT("Allocations: %llu\n", allocation_count - allocations_start);
+
+    allocations_start = allocation_count;
+    PRINT("Move large:  %f\n", testbench::benchmark([]() {
+              gtl::any any(large_type{});
+              for (unsigned long long int iteration = 0; iteration < iterations; ++iteration) {
+                  gtl::any moved(static_cast<gtl::any&&>(any));
+                  any = static_cast<gtl::any&&>(moved);
+              }
+              testbench::do_not_optimise_away(any);
+          }));
+    PRINT("Allocations: %llu\n", allocation_count - allocations_start);
+}
@@ -0,0 +1,129 @@
+/*
+Copyright (C) 2018-2024 Geoffrey Daniels. https://gpdaniels.com/
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, version 3 of the License only.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <testbench/main.tests.hpp>
+
+#include <testbench/benchmark.tests.hpp>
+#include <testbench/optimise.tests.hpp>
+#include <testbench/require.tests.hpp>
+
+#include <container/arena>
+
+#if defined(_MSC_VER)
+#pragma warning(push, 0)
+#endif
+
+#include <list>
+#include <map>
+#include <type_traits>
+#include <vector>
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+
+TEST(arena, traits, standard) {
+    REQUIRE((std::is_copy_constructible<gtl::arena>::value == false), "Expected std::is_copy_constructible to be false.");
+    REQUIRE((std::is_move_constructible<gtl::arena>::value == false), "Expected std::is_move_constructible to be false.");
+    REQUIRE((std::is_copy_constructible<gtl::arena_allocator<int>>::value == true), "Expected std::is_copy_constructible to be true.");
+}
+
+TEST(arena, constructor, empty) {
+    gtl::arena arena;
+    REQUIRE(arena.used() == 0);
+    REQUIRE(arena.peak() == 0);
+    REQUIRE(arena.reserved() == 0);
+}
+
+TEST(arena, function, allocate) {
+    gtl::arena arena(64);
+    void* first = arena.allocate(1, 1);
+    void* second = arena.allocate(8, 8);
+    void* third = arena.allocate(32, 32);
+    REQUIRE(first != nullptr);
+    REQUIRE((reinterpret_cast<unsigned long long int>(second) % 8) == 0);
+    REQUIRE((reinterpret_cast<unsigned long long int>(third) % 32) == 0);
+    REQUIRE(arena.used() >= 41);
+
+    // Allocations larger than a chunk grow the arena.
+    void* large = arena.allocate(1000, 16);
+    REQUIRE(large != nullptr);
+    REQUIRE(arena.reserved() >= 1064);
+    REQUIRE(arena.peak() == arena.used());
+
+    const unsigned long long int peak = arena.peak();
+    arena.reset();
+    REQUIRE(arena.used() == 0);
+    REQUIRE(arena.peak() == peak);
+    const unsigned long long int reserved = arena.reserved();
+    REQUIRE(reserved > 0);
+
+    // After a reset the kept chunk serves allocations without growing.
+    for (int index = 0; index < 10; ++index) {
+        static_cast<void>(arena.allocate(8));
+    }
+    REQUIRE(arena.reserved() == reserved);
+
+    arena.release();
+    REQUIRE(arena.reserved() == 0);
+}
+
+TEST(arena, function, allocator) {
+    gtl::arena arena;
+    {
+        std::vector<int, gtl::arena_allocator<int>> vector{ gtl::arena_allocator<int>(arena) };
+        for (int index = 0; index < 1000; ++index) {
+            vector.push_back(index);
+        }
+        REQUIRE(vector[999] == 999);
+
+        std::map<int, int, std::less<int>, gtl::arena_allocator<std::pair<const int, int>>> map{ gtl::arena_allocator<std::pair<const int, int>>(arena) };
+        for (int index = 0; index < 1000; ++index) {
+            map[index] = index * 2;
+        }
+        REQUIRE(map[500] == 1000);
+    }
+    REQUIRE(arena.used() > 0);
+    arena.reset();
+    REQUIRE(arena.used() == 0);
+}
+
+TEST(arena, evaluate, benchmark) {
+    constexpr static const int size = 10000;
+
+    PRINT("std::allocator:        %f\n", testbench::benchmark([&]() {
+              std::list<int> list;
+              for (int index = 0; index < size; ++index) {
+                  list.push_back(index);
+              }
+              testbench::do_not_optimise_away(list);
+          }, 100));
+
+    gtl::arena arena;
+    PRINT("gtl::arena_allocator:  %f\n", testbench::benchmark([&]() {
+              {
+                  std::list<int, gtl::arena_allocator<int>> list{ gtl::arena_allocator<int>(arena) };
+                  for (int index = 0; index < size; ++index) {
+                      list.push_back(index);
+                  }
+                  testbench::do_not_optimise_away(list);
+              }
+              arena.reset();
+          }, 100));
+
+    PRINT("Peak bytes:            %llu\n", arena.peak());
+    PRINT("Reserved bytes:        %llu\n", arena.reserved());
+}
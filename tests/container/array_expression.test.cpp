@@ -0,0 +1,253 @@
+/*
+Copyright (C) 2018-2024 Geoffrey Daniels. https://gpdaniels.com/
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, version 3 of the License only.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <testbench/main.tests.hpp>
+
+#include <testbench/benchmark.tests.hpp>
+#include <testbench/comparison.tests.hpp>
+#include <testbench/optimise.tests.hpp>
+#include <testbench/require.tests.hpp>
+
+#include <container/array_expression>
+
+#if defined(_MSC_VER)
+#pragma warning(push, 0)
+#endif
+
+#include <type_traits>
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+
+TEST(array_expression, traits, standard) {
+    using array_type = gtl::array_nd<float, 4, 4>;
+    using expression_type = decltype(std::declval<const array_type&>() + std::declval<const array_type&>());
+    REQUIRE((std::is_same<typename expression_type::array_expression_tag, gtl::array_expression::expression_tag>::value), "Expected addition of arrays to produce an expression.");
+    REQUIRE((std::is_same<typename expression_type::value_type, float>::value), "Expected the expression value type to be float.");
+    REQUIRE((std::is_same<typename expression_type::order_type, typename array_type::layout>::value), "Expected the expression order type to be the layout of the array.");
+    REQUIRE((std::is_trivially_copyable<expression_type>::value), "Expected expressions to be trivially copyable.");
+}
+
+TEST(array_expression, evaluate, elementwise) {
+    gtl::array_nd<float, 7, 5> lhs;
+    gtl::array_nd<float, 7, 5> rhs;
+    for (unsigned long long int y = 0; y < 5; ++y) {
+        for (unsigned long long int x = 0; x < 7; ++x) {
+            lhs(x, y) = static_cast<float>(x + y * 7);
+            rhs(x, y) = static_cast<float>(x * y) + 1.0f;
+        }
+    }
+
+    gtl::array_nd<float, 7, 5> result;
+    result = lhs + rhs * 2.0f - 1.0f;
+    for (unsigned long long int y = 0; y < 5; ++y) {
+        for (unsigned long long int x = 0; x < 7; ++x) {
+            REQUIRE(testbench::is_value_equal(result(x, y), lhs(x, y) + rhs(x, y) * 2.0f - 1.0f));
+        }
+    }
+
+    result = -lhs / rhs;
+    for (unsigned long long int y = 0; y < 5; ++y) {
+        for (unsigned long long int x = 0; x < 7; ++x) {
+            REQUIRE(testbench::is_value_equal(result(x, y), -lhs(x, y) / rhs(x, y)));
+        }
+    }
+
+    result = gtl::array_expression::maximum(lhs, rhs) - gtl::array_expression::minimum(lhs, 10.0f);
+    for (unsigned long long int y = 0; y < 5; ++y) {
+        for (unsigned long long int x = 0; x < 7; ++x) {
+            const float maximum = lhs(x, y) < rhs(x, y) ? rhs(x, y) : lhs(x, y);
+            const float minimum = lhs(x, y) < 10.0f ? lhs(x, y) : 10.0f;
+            REQUIRE(testbench::is_value_equal(result(x, y), maximum - minimum));
+        }
+    }
+
+    result = gtl::array_expression::absolute(10.0f - lhs);
+    for (unsigned long long int y = 0; y < 5; ++y) {
+        for (unsigned long long int x = 0; x < 7; ++x) {
+            const float difference = 10.0f - lhs(x, y);
+            REQUIRE(testbench::is_value_equal(result(x, y), difference < 0.0f ? -difference : difference));
+        }
+    }
+
+    // An expression may read from its own target as each value only depends on the same location.
+    result = result + result;
+    for (unsigned long long int y = 0; y < 5; ++y) {
+        for (unsigned long long int x = 0; x < 7; ++x) {
+            const float difference = 10.0f - lhs(x, y);
+            REQUIRE(testbench::is_value_equal(result(x, y), 2.0f * (difference < 0.0f ? -difference : difference)));
+        }
+    }
+}
+
+TEST(array_expression, evaluate, dynamic) {
+    gtl::array_nd<int, 0, 3> lhs(37);
+    gtl::array_nd<int, 0, 3> rhs(37);
+    for (unsigned long long int y = 0; y < 3; ++y) {
+        for (unsigned long long int x = 0; x < 37; ++x) {
+            lhs(x, y) = static_cast<int>(x) - 20;
+            rhs(x, y) = static_cast<int>(y) + 1;
+        }
+    }
+
+    gtl::array_nd<int, 0, 3> result(37);
+    result = lhs * rhs + 3;
+    for (unsigned long long int y = 0; y < 3; ++y) {
+        for (unsigned long long int x = 0; x < 37; ++x) {
+            REQUIRE(result(x, y) == lhs(x, y) * rhs(x, y) + 3);
+        }
+    }
+
+    result = gtl::array_expression::scalar<int>(7);
+    REQUIRE(gtl::array_expression::sum(result) == 7 * 37 * 3);
+}
+
+TEST(array_expression, evaluate, reductions) {
+    gtl::array_nd<double, 0> values(1001);
+    double expected_sum = 0.0;
+    double expected_dot = 0.0;
+    for (unsigned long long int x = 0; x < 1001; ++x) {
+        values(x) = static_cast<double>((x * 37) % 101) - 50.0;
+        expected_sum += values(x);
+        expected_dot += values(x) * values(x);
+    }
+    REQUIRE(testbench::is_value_approx(gtl::array_expression::sum(values), expected_sum, 1e-9));
+    REQUIRE(testbench::is_value_approx(gtl::array_expression::dot(values, values), expected_dot, 1e-9));
+    REQUIRE(testbench::is_value_equal(gtl::array_expression::min(values), -50.0));
+    REQUIRE(testbench::is_value_equal(gtl::array_expression::max(values), 50.0));
+    REQUIRE(testbench::is_value_approx(gtl::array_expression::sum(values * 2.0 + 1.0), expected_sum * 2.0 + 1001.0, 1e-9));
+    REQUIRE(testbench::is_value_equal(gtl::array_expression::max(-values), 50.0));
+
+    gtl::array_nd<int, 3> small;
+    small(0) = 5;
+    small(1) = -2;
+    small(2) = 9;
+    REQUIRE(gtl::array_expression::sum(small) == 12);
+    REQUIRE(gtl::array_expression::min(small) == -2);
+    REQUIRE(gtl::array_expression::max(small) == 9);
+}
+
+TEST(array_expression, evaluate, padded) {
+    using layout = gtl::array_nd_layout::row_major<1, 4>;
+    gtl::basic_array_nd<layout, int, 0, 3> lhs(5);
+    gtl::basic_array_nd<layout, int, 0, 3> rhs(5);
+    gtl::basic_array_nd<layout, int, 0, 3> result(5);
+    REQUIRE(lhs.storage_size() > lhs.size());
+    // The padding of the operands is left uninitialised, and the padding of the result is marked, as evaluation must not touch either.
+    constexpr static const int marker = 12345;
+    for (unsigned long long int offset = 0; offset < result.storage_size(); ++offset) {
+        result.data()[offset] = marker;
+    }
+    for (unsigned long long int y = 0; y < 3; ++y) {
+        for (unsigned long long int x = 0; x < 5; ++x) {
+            lhs(x, y) = static_cast<int>(x);
+            rhs(x, y) = static_cast<int>(y) * 10;
+        }
+    }
+
+    // Integer division would trap if the divisor were evaluated over padding.
+    result = lhs / (rhs + 1);
+    for (unsigned long long int y = 0; y < 3; ++y) {
+        for (unsigned long long int x = 0; x < 5; ++x) {
+            REQUIRE(result(x, y) == lhs(x, y) / (rhs(x, y) + 1));
+        }
+    }
+
+    result = lhs + rhs;
+    unsigned long long int markers = 0;
+    for (unsigned long long int offset = 0; offset < result.storage_size(); ++offset) {
+        markers += (result.data()[offset] == marker) ? 1 : 0;
+    }
+    REQUIRE(markers == result.storage_size() - result.size());
+    int expected_sum = 0;
+    int expected_dot = 0;
+    for (unsigned long long int y = 0; y < 3; ++y) {
+        for (unsigned long long int x = 0; x < 5; ++x) {
+            REQUIRE(result(x, y) == lhs(x, y) + rhs(x, y));
+            expected_sum += result(x, y);
+            expected_dot += lhs(x, y) * rhs(x, y);
+        }
+    }
+    REQUIRE(gtl::array_expression::sum(result) == expected_sum);
+    REQUIRE(gtl::array_expression::dot(lhs, rhs) == expected_dot);
+    REQUIRE(gtl::array_expression::min(result - 100) == -100);
+    REQUIRE(gtl::array_expression::max(result) == 24);
+}
+
+TEST(array_expression, evaluate, static_array_nd) {
+    gtl::static_array_nd<float, 3, 17> lhs = {};
+    gtl::static_array_nd<float, 3, 17> rhs = {};
+    for (unsigned long long int y = 0; y < 3; ++y) {
+        for (unsigned long long int x = 0; x < 17; ++x) {
+            lhs(y, x) = static_cast<float>(x);
+            rhs(y, x) = static_cast<float>(y);
+        }
+    }
+
+    gtl::static_array_nd<float, 3, 17> result = {};
+    result = lhs * rhs + lhs;
+    float expected_sum = 0.0f;
+    for (unsigned long long int y = 0; y < 3; ++y) {
+        for (unsigned long long int x = 0; x < 17; ++x) {
+            REQUIRE(testbench::is_value_equal(result(y, x), lhs(y, x) * rhs(y, x) + lhs(y, x)));
+            expected_sum += result(y, x);
+        }
+    }
+    REQUIRE(testbench::is_value_approx(gtl::array_expression::sum(result), expected_sum, 1e-3f));
+    REQUIRE(testbench::is_value_equal(gtl::array_expression::dot(lhs, rhs), 3.0f * 136.0f));
+}
+
+TEST(array_expression, evaluate, benchmark) {
+    constexpr static const unsigned long long int size = 1 << 16;
+    gtl::array_nd<float, 0> a(size);
+    gtl::array_nd<float, 0> b(size);
+    gtl::array_nd<float, 0> c(size);
+    gtl::array_nd<float, 0> result(size);
+    for (unsigned long long int x = 0; x < size; ++x) {
+        a(x) = static_cast<float>(x % 13);
+        b(x) = static_cast<float>(x % 7);
+        c(x) = static_cast<float>(x % 5);
+    }
+
+    PRINT("Temporaries: %f\n", testbench::benchmark([&]() {
+              gtl::array_nd<float, 0> product(size);
+              for (unsigned long long int x = 0; x < size; ++x) {
+                  product(x) = b(x) * c(x);
+              }
+              gtl::array_nd<float, 0> total(size);
+              for (unsigned long long int x = 0; x < size; ++x) {
+                  total(x) = a(x) + product(x);
+              }
+              for (unsigned long long int x = 0; x < size; ++x) {
+                  result(x) = total(x) - 1.0f;
+              }
+              testbench::do_not_optimise_away(result);
+          }, 100));
+
+    PRINT("Expression:  %f\n", testbench::benchmark([&]() {
+              result = a + b * c - 1.0f;
+              testbench::do_not_optimise_away(result);
+          }, 100));
+
+    PRINT("Dot:         %f\n", testbench::benchmark([&]() {
+              testbench::do_not_optimise_away(gtl::array_expression::dot(a, b));
+          }, 100));
+
+    for (unsigned long long int x = 0; x < size; ++x) {
+        REQUIRE(testbench::is_value_equal(result(x), a(x) + b(x) * c(x) - 1.0f));
+    }
+}
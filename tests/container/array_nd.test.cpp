@@ -284,3 +284,102 @@ TEST(array_nd, operator, parenthesis) {
         }
     );
 }
+
+TEST(array_nd, layout, row_major) {
+    using array_type = gtl::basic_array_nd<gtl::array_nd_layout::row_major<64, 16>, float, 0, 0>;
+    array_type array(10, 5);
+    REQUIRE(array.size() == 50);
+    REQUIRE(array.storage_size() == 16 * 5, "array.storage_size() = %llu, expected %llu", array.storage_size(), 16ull * 5ull);
+    REQUIRE(array.step(0) == 1);
+    REQUIRE(array.step(1) == 16);
+    REQUIRE((reinterpret_cast<unsigned long long int>(array.data()) % 64) == 0, "Expected the data to be aligned to 64 bytes.");
+    for (unsigned long long int y = 0; y < 5; ++y) {
+        REQUIRE((reinterpret_cast<unsigned long long int>(array.data(0, y)) % 64) == 0, "Expected every row to be aligned to 64 bytes.");
+        for (unsigned long long int x = 0; x < 10; ++x) {
+            array(x, y) = static_cast<float>(x + y * 100);
+        }
+    }
+    unsigned long long int count = 0;
+    for (array_type::iterator iterator = array.begin(); iterator != array.end(); ++iterator) {
+        REQUIRE(testbench::is_value_equal(*iterator, static_cast<float>(iterator.index(0) + iterator.index(1) * 100)));
+        REQUIRE(iterator.index(0) == count % 10);
+        REQUIRE(iterator.index(1) == count / 10);
+        ++count;
+    }
+    REQUIRE(count == array.size());
+}
+
+TEST(array_nd, layout, tiled) {
+    using array_type = gtl::basic_array_nd<gtl::array_nd_layout::tiled<4>, int, 0, 0>;
+    array_type array(10, 7);
+    REQUIRE(array.size() == 70);
+    REQUIRE(array.storage_size() == 12 * 8, "array.storage_size() = %llu, expected %llu", array.storage_size(), 12ull * 8ull);
+    REQUIRE(array.step(0) == 0);
+    for (unsigned long long int y = 0; y < 7; ++y) {
+        for (unsigned long long int x = 0; x < 10; ++x) {
+            array(x, y) = static_cast<int>(x + y * 100);
+        }
+    }
+    // The first tile is stored contiguously.
+    REQUIRE(array.data(1, 0) == array.data(0, 0) + 1);
+    REQUIRE(array.data(0, 1) == array.data(0, 0) + 4);
+    REQUIRE(array.data(4, 0) == array.data(0, 0) + 16);
+    unsigned long long int count = 0;
+    for (const int& value : array) {
+        testbench::do_not_optimise_away(value);
+        ++count;
+    }
+    REQUIRE(count == array.size());
+    for (array_type::iterator iterator = array.begin(); iterator != array.end(); ++iterator) {
+        REQUIRE(*iterator == static_cast<int>(iterator.index(0) + iterator.index(1) * 100));
+    }
+
+    gtl::basic_array_nd<gtl::array_nd_layout::tiled<4>, int, 10, 7> static_array;
+    REQUIRE(static_array.storage_size() == 12 * 8);
+    for (unsigned long long int y = 0; y < 7; ++y) {
+        for (unsigned long long int x = 0; x < 10; ++x) {
+            static_array(x, y) = static_cast<int>(x + y * 100);
+        }
+    }
+    for (unsigned long long int y = 0; y < 7; ++y) {
+        for (unsigned long long int x = 0; x < 10; ++x) {
+            REQUIRE(static_array(x, y) == array(x, y));
+        }
+    }
+}
+
+TEST(array_nd, layout, morton) {
+    using array_type = gtl::basic_array_nd<gtl::array_nd_layout::morton<32>, long long int, 0, 0, 0>;
+    array_type array(5, 3, 2);
+    REQUIRE(array.size() == 30);
+    REQUIRE(array.storage_size() == 8 * 4 * 2, "array.storage_size() = %llu, expected %llu", array.storage_size(), 8ull * 4ull * 2ull);
+    REQUIRE((reinterpret_cast<unsigned long long int>(array.data()) % 32) == 0, "Expected the data to be aligned to 32 bytes.");
+    REQUIRE(array.data(1, 0, 0) == array.data() + 1);
+    REQUIRE(array.data(0, 1, 0) == array.data() + 2);
+    REQUIRE(array.data(0, 0, 1) == array.data() + 4);
+    REQUIRE(array.data(1, 1, 1) == array.data() + 7);
+    REQUIRE(array.data(2, 0, 0) == array.data() + 8);
+    for (unsigned long long int z = 0; z < 2; ++z) {
+        for (unsigned long long int y = 0; y < 3; ++y) {
+            for (unsigned long long int x = 0; x < 5; ++x) {
+                array(x, y, z) = static_cast<long long int>(x + y * 100 + z * 10000);
+            }
+        }
+    }
+    unsigned long long int count = 0;
+    const long long int* previous = nullptr;
+    for (array_type::const_iterator iterator = static_cast<const array_type&>(array).begin(); iterator != static_cast<const array_type&>(array).end(); ++iterator) {
+        REQUIRE(*iterator == static_cast<long long int>(iterator.index(0) + iterator.index(1) * 100 + iterator.index(2) * 10000));
+        REQUIRE((previous == nullptr) || (previous < &*iterator), "Expected iteration to be in storage order.");
+        previous = &*iterator;
+        ++count;
+    }
+    REQUIRE(count == array.size());
+
+    array_type copy = array;
+    REQUIRE(copy.storage_size() == array.storage_size());
+    REQUIRE(copy(4, 2, 1) == array(4, 2, 1));
+    array_type moved = static_cast<array_type&&>(copy);
+    REQUIRE(moved(4, 2, 1) == array(4, 2, 1));
+    REQUIRE(copy.data() == nullptr);
+}
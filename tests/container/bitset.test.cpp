@@ -0,0 +1,159 @@
+/*
+Copyright (C) 2018-2024 Geoffrey Daniels. https://gpdaniels.com/
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, version 3 of the License only.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <testbench/main.tests.hpp>
+
+#include <testbench/benchmark.tests.hpp>
+#include <testbench/optimise.tests.hpp>
+#include <testbench/require.tests.hpp>
+
+#include <container/bitset>
+
+#if defined(_MSC_VER)
+#pragma warning(push, 0)
+#endif
+
+#include <type_traits>
+#include <vector>
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+
+TEST(bitset, traits, standard) {
+    REQUIRE((std::is_copy_constructible<gtl::bitset>::value == true), "Expected std::is_copy_constructible to be true.");
+    REQUIRE((std::is_move_constructible<gtl::bitset>::value == true), "Expected std::is_move_constructible to be true.");
+    REQUIRE((std::is_standard_layout<gtl::bitset>::value == true), "Expected std::is_standard_layout to be true.");
+}
+
+TEST(bitset, constructor, size) {
+    gtl::bitset empty;
+    REQUIRE(empty.size() == 0);
+    REQUIRE(empty.none());
+    REQUIRE(empty.find_first() == 0);
+    REQUIRE(empty.begin() == empty.end());
+
+    gtl::bitset clear(130);
+    REQUIRE(clear.size() == 130);
+    REQUIRE(clear.word_count() == 3);
+    REQUIRE(clear.count() == 0);
+
+    gtl::bitset full(130, true);
+    REQUIRE(full.count() == 130);
+    REQUIRE(full.all());
+    // Bits past the size must stay clear.
+    REQUIRE(full.data()[2] == 0x3);
+}
+
+TEST(bitset, function, bits) {
+    gtl::bitset bits(200);
+    bits.set(0);
+    bits.set(63);
+    bits.set(64);
+    bits.set(199);
+    REQUIRE(bits.count() == 4);
+    REQUIRE(bits.test(63));
+    REQUIRE(bits[64]);
+    REQUIRE(bits.test(65) == false);
+    bits.reset(63);
+    bits.flip(65);
+    bits.set(100, true);
+    bits.set(0, false);
+    REQUIRE(bits.count() == 4);
+
+    std::vector<unsigned long long int> indexes;
+    for (unsigned long long int index : bits) {
+        indexes.push_back(index);
+    }
+    REQUIRE(indexes.size() == 4);
+    REQUIRE(indexes[0] == 64);
+    REQUIRE(indexes[1] == 65);
+    REQUIRE(indexes[2] == 100);
+    REQUIRE(indexes[3] == 199);
+    REQUIRE(bits.find_first() == 64);
+    REQUIRE(bits.find_next(101) == 199);
+    bits.reset(199);
+    REQUIRE(bits.find_next(101) == 200);
+
+    bits.flip();
+    REQUIRE(bits.count() == 197);
+    bits.set();
+    REQUIRE(bits.all());
+    bits.reset();
+    REQUIRE(bits.none());
+
+    bits.set(10);
+    bits.resize(1000, true);
+    REQUIRE(bits.size() == 1000);
+    REQUIRE(bits.test(10));
+    REQUIRE(bits.test(11) == false);
+    REQUIRE(bits.count() == 801);
+    bits.resize(11);
+    REQUIRE(bits.count() == 1);
+}
+
+TEST(bitset, function, operators) {
+    gtl::bitset lhs(300);
+    gtl::bitset rhs(300);
+    for (unsigned long long int index = 0; index < 300; ++index) {
+        lhs.set(index, (index % 2) == 0);
+        rhs.set(index, (index % 3) == 0);
+    }
+    REQUIRE((lhs & rhs).count() == 50);
+    REQUIRE((lhs | rhs).count() == 200);
+    REQUIRE((lhs ^ rhs).count() == 150);
+    REQUIRE(gtl::bitset(lhs).and_not(rhs).count() == 100);
+    REQUIRE((~lhs).count() == 150);
+    REQUIRE(lhs.intersects(rhs));
+    REQUIRE(lhs.intersects(~lhs) == false);
+    REQUIRE(lhs == lhs);
+    REQUIRE(lhs != rhs);
+    REQUIRE(((lhs & rhs) | gtl::bitset(lhs).and_not(rhs)) == lhs);
+}
+
+TEST(bitset, evaluate, benchmark) {
+    constexpr static const unsigned long long int size = 1 << 16;
+    std::vector<bool> vector_lhs(size);
+    std::vector<bool> vector_rhs(size);
+    gtl::bitset bitset_lhs(size);
+    gtl::bitset bitset_rhs(size);
+    for (unsigned long long int index = 0; index < size; ++index) {
+        vector_lhs[index] = (index % 3) == 0;
+        vector_rhs[index] = (index % 5) == 0;
+        bitset_lhs.set(index, (index % 3) == 0);
+        bitset_rhs.set(index, (index % 5) == 0);
+    }
+
+    unsigned long long int vector_count = 0;
+    unsigned long long int bitset_count = 0;
+
+    PRINT("std::vector<bool>: %f\n", testbench::benchmark([&]() {
+              vector_count = 0;
+              for (unsigned long long int index = 0; index < size; ++index) {
+                  vector_count += vector_lhs[index] && vector_rhs[index];
+              }
+              testbench::do_not_optimise_away(vector_count);
+          }, 100));
+
+    PRINT("gtl::bitset:       %f\n", testbench::benchmark([&]() {
+              gtl::bitset result = bitset_lhs;
+              result &= bitset_rhs;
+              bitset_count = result.count();
+              testbench::do_not_optimise_away(bitset_count);
+          }, 100));
+
+    REQUIRE(vector_count == bitset_count);
+}
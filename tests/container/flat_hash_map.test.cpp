@@ -0,0 +1,197 @@
+/*
+Copyright (C) 2018-2024 Geoffrey Daniels. https://gpdaniels.com/
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, version 3 of the License only.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <testbench/main.tests.hpp>
+
+#include <testbench/benchmark.tests.hpp>
+#include <testbench/optimise.tests.hpp>
+#include <testbench/require.tests.hpp>
+
+#include <container/flat_hash_map>
+
+#if defined(_MSC_VER)
+#pragma warning(push, 0)
+#endif
+
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+
+TEST(flat_hash_map, traits, standard) {
+    REQUIRE((std::is_default_constructible<gtl::flat_hash_map<int, int>>::value == true), "Expected std::is_default_constructible to be true.");
+    REQUIRE((std::is_copy_constructible<gtl::flat_hash_map<int, int>>::value == true), "Expected std::is_copy_constructible to be true.");
+    REQUIRE((std::is_move_constructible<gtl::flat_hash_map<int, int>>::value == true), "Expected std::is_move_constructible to be true.");
+    REQUIRE((std::is_default_constructible<gtl::flat_hash_set<int>>::value == true), "Expected std::is_default_constructible to be true.");
+}
+
+TEST(flat_hash_map, constructor, empty) {
+    gtl::flat_hash_map<int, int> map;
+    REQUIRE(map.empty());
+    REQUIRE(map.size() == 0);
+    REQUIRE(map.capacity() == 0);
+    REQUIRE(map.begin() == map.end());
+    REQUIRE(map.find(1) == map.end());
+    REQUIRE(map.contains(1) == false);
+    REQUIRE(map.erase(1) == 0);
+
+    gtl::flat_hash_set<int> set;
+    REQUIRE(set.empty());
+    REQUIRE(set.contains(1) == false);
+}
+
+TEST(flat_hash_map, constructor, initializer_list) {
+    const gtl::flat_hash_map<int, int> map = { { 1, 10 }, { 2, 20 }, { 3, 30 } };
+    REQUIRE(map.size() == 3);
+    REQUIRE(map.at(1) == 10);
+    REQUIRE(map.at(2) == 20);
+    REQUIRE(map.at(3) == 30);
+
+    gtl::flat_hash_map<int, int> copy = map;
+    REQUIRE(copy.size() == 3);
+    copy[4] = 40;
+    REQUIRE(copy.size() == 4);
+    REQUIRE(map.size() == 3);
+
+    gtl::flat_hash_map<int, int> moved = static_cast<gtl::flat_hash_map<int, int>&&>(copy);
+    REQUIRE(moved.size() == 4);
+    REQUIRE(moved.at(4) == 40);
+    REQUIRE(copy.empty());
+}
+
+TEST(flat_hash_map, function, insert_find_erase) {
+    gtl::flat_hash_map<int, int> map;
+    for (int index = 0; index < 10000; ++index) {
+        REQUIRE(map.insert({ index, index * 2 }).second == true);
+    }
+    REQUIRE(map.size() == 10000);
+    REQUIRE(map.insert({ 5, 0 }).second == false);
+    REQUIRE(map.load_factor() <= 0.875f);
+    for (int index = 0; index < 10000; ++index) {
+        const auto iterator = map.find(index);
+        REQUIRE(iterator != map.end());
+        REQUIRE(iterator->first == index);
+        REQUIRE(iterator->second == index * 2);
+    }
+    REQUIRE(map.find(10000) == map.end());
+
+    for (int index = 0; index < 10000; index += 2) {
+        REQUIRE(map.erase(index) == 1);
+    }
+    REQUIRE(map.size() == 5000);
+    for (int index = 0; index < 10000; ++index) {
+        REQUIRE(map.contains(index) == ((index % 2) == 1));
+    }
+
+    unsigned long long int count = 0;
+    long long int sum = 0;
+    for (const auto& [key, value] : map) {
+        ++count;
+        sum += value - key;
+    }
+    REQUIRE(count == 5000);
+    REQUIRE(sum == 25000000);
+
+    // Repeatedly inserting and erasing must reuse deleted slots rather than growing forever.
+    const unsigned long long int capacity = map.capacity();
+    for (int index = 0; index < 100000; ++index) {
+        map[20000 + index] = index;
+        map.erase(20000 + index);
+    }
+    REQUIRE(map.capacity() == capacity);
+    REQUIRE(map.size() == 5000);
+
+    for (auto iterator = map.begin(); iterator != map.end();) {
+        iterator = map.erase(iterator);
+    }
+    REQUIRE(map.empty());
+
+    map.clear();
+    REQUIRE(map.empty());
+    REQUIRE(map.capacity() == capacity);
+}
+
+TEST(flat_hash_map, function, reserve) {
+    gtl::flat_hash_map<int, std::string> map;
+    map.reserve(1000);
+    const unsigned long long int capacity = map.capacity();
+    REQUIRE(capacity >= 1000);
+    for (int index = 0; index < 1000; ++index) {
+        map.try_emplace(index, std::to_string(index));
+    }
+    REQUIRE(map.capacity() == capacity);
+    REQUIRE(map.at(123) == "123");
+    REQUIRE(map.try_emplace(123, "other").second == false);
+    REQUIRE(map.at(123) == "123");
+}
+
+TEST(flat_hash_map, function, heterogeneous) {
+    struct string_hash final {
+        using is_transparent = void;
+        std::size_t operator()(std::string_view value) const {
+            return std::hash<std::string_view>()(value);
+        }
+    };
+
+    gtl::flat_hash_map<std::string, int, string_hash, std::equal_to<>> map;
+    map["one"] = 1;
+    map["two"] = 2;
+    const std::string_view key = "two";
+    REQUIRE(map.contains(key));
+    REQUIRE(map.find(key)->second == 2);
+    REQUIRE(map.at(key) == 2);
+    REQUIRE(map.count("three") == 0);
+    REQUIRE(map.erase(std::string_view("one")) == 1);
+    REQUIRE(map.size() == 1);
+
+    gtl::flat_hash_set<std::string, string_hash, std::equal_to<>> set = { "alpha", "beta" };
+    REQUIRE(set.contains(std::string_view("alpha")));
+    REQUIRE(set.contains(std::string_view("gamma")) == false);
+}
+
+TEST(flat_hash_map, evaluate, benchmark) {
+    constexpr static const int size = 1 << 16;
+
+    PRINT("std::unordered_map: %f\n", testbench::benchmark([&]() {
+              std::unordered_map<int, int> map;
+              for (int index = 0; index < size; ++index) {
+                  map[index * 7] = index;
+              }
+              int total = 0;
+              for (int index = 0; index < size * 2; ++index) {
+                  const auto iterator = map.find(index);
+                  total += (iterator != map.end()) ? iterator->second : 0;
+              }
+              testbench::do_not_optimise_away(total);
+          }, 10));
+
+    PRINT("gtl::flat_hash_map: %f\n", testbench::benchmark([&]() {
+              gtl::flat_hash_map<int, int> map;
+              for (int index = 0; index < size; ++index) {
+                  map[index * 7] = index;
+              }
+              int total = 0;
+              for (int index = 0; index < size * 2; ++index) {
+                  const auto iterator = map.find(index);
+                  total += (iterator != map.end()) ? iterator->second : 0;
+              }
+              testbench::do_not_optimise_away(total);
+          }, 10));
+}
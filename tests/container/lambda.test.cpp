@@ -16,15 +16,18 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 #include <testbench/main.tests.hpp>
 
+#include <testbench/benchmark.tests.hpp>
 #include <testbench/optimise.tests.hpp>
 #include <testbench/require.tests.hpp>
 
 #include <container/lambda>
+#include <container/static_lambda>
 
 #if defined(_MSC_VER)
 #pragma warning(push, 0)
 #endif
 
+#include <functional>
 #include <type_traits>
 
 #if defined(_MSC_VER)
@@ -468,3 +471,166 @@ TEST(lambda, evaluate, construction_and_destruction) {
     }
     REQUIRE(destructed == 2);
 }
+
+TEST(lambda, evaluate, storage) {
+    static int moved = 0;
+    static int destructed = 0;
+
+    struct small_type {
+        int value;
+
+        small_type(int initial_value)
+            : value(initial_value) {
+        }
+
+        small_type(const small_type& other)
+            : value(other.value) {
+        }
+
+        small_type(small_type&& other) noexcept
+            : value(other.value) {
+            ++moved;
+        }
+
+        small_type& operator=(const small_type&) = delete;
+        small_type& operator=(small_type&&) = delete;
+
+        int operator()() const {
+            return this->value;
+        }
+
+        ~small_type() {
+            ++destructed;
+        }
+    };
+
+    struct throwing_move_type {
+        int value;
+
+        throwing_move_type(int initial_value)
+            : value(initial_value) {
+        }
+
+        throwing_move_type(const throwing_move_type& other)
+            : value(other.value) {
+        }
+
+        int operator()() const {
+            return this->value;
+        }
+    };
+
+    struct large_type {
+        int values[64];
+
+        int operator()() const {
+            return this->values[0] + this->values[63];
+        }
+    };
+
+    struct alignas(64) aligned_type {
+        int value;
+
+        int operator()() const {
+            return this->value;
+        }
+    };
+
+    REQUIRE(gtl::lambda<int()>::stores_inline<small_type>());
+    REQUIRE(!gtl::lambda<int()>::stores_inline<throwing_move_type>());
+    REQUIRE(!gtl::lambda<int()>::stores_inline<large_type>());
+    REQUIRE(!gtl::lambda<int()>::stores_inline<aligned_type>());
+    REQUIRE((gtl::lambda<int(), sizeof(large_type)>::stores_inline<large_type>()));
+
+    {
+        gtl::lambda<int()> lambda(small_type(123));
+        REQUIRE(moved == 1);
+        REQUIRE(destructed == 1);
+        gtl::lambda<int()> relocated(static_cast<gtl::lambda<int()>&&>(lambda));
+        REQUIRE(!lambda);
+        REQUIRE(moved == 2);
+        REQUIRE(destructed == 2);
+        REQUIRE(relocated() == 123);
+        gtl::lambda<int()> copied(relocated);
+        REQUIRE(copied() == 123);
+        REQUIRE(relocated() == 123);
+    }
+    REQUIRE(destructed == 4);
+
+    {
+        large_type large = {};
+        large.values[0] = 100;
+        large.values[63] = 23;
+        gtl::lambda<int()> lambda(large);
+        gtl::lambda<int()> moved_lambda(static_cast<gtl::lambda<int()>&&>(lambda));
+        REQUIRE(!lambda);
+        REQUIRE(moved_lambda() == 123);
+        gtl::lambda<int()> copied(moved_lambda);
+        REQUIRE(copied() == 123);
+        copied = nullptr;
+        REQUIRE(!copied);
+        copied = moved_lambda;
+        REQUIRE(copied() == 123);
+    }
+
+    {
+        gtl::lambda<int()> lambda(throwing_move_type(456));
+        gtl::lambda<int()> moved_lambda(static_cast<gtl::lambda<int()>&&>(lambda));
+        REQUIRE(!lambda);
+        REQUIRE(moved_lambda() == 456);
+    }
+
+    {
+        gtl::lambda<int()> lambda(aligned_type{ 321 });
+        gtl::lambda<int()> copied;
+        copied = lambda;
+        REQUIRE(lambda() == 321);
+        REQUIRE(copied() == 321);
+    }
+}
+
+TEST(lambda, evaluate, benchmark) {
+    constexpr static const unsigned long long int iterations = 100000;
+    int small_capture[2] = { 1, 2 };
+    int large_capture[32] = { 1, 2 };
+
+    PRINT("std::function small:  %f\n", testbench::benchmark([&]() {
+              for (unsigned long long int iteration = 0; iteration < iterations; ++iteration) {
+                  std::function<int(int)> function = [small_capture](int value) { return value + small_capture[0] + small_capture[1]; };
+                  std::function<int(int)> moved = std::move(function);
+                  testbench::do_not_optimise_away(moved(static_cast<int>(iteration)));
+              }
+          }));
+
+    PRINT("static_lambda small:  %f\n", testbench::benchmark([&]() {
+              for (unsigned long long int iteration = 0; iteration < iterations; ++iteration) {
+                  gtl::static_lambda<int(int), 32> function = [small_capture](int value) { return value + small_capture[0] + small_capture[1]; };
+                  gtl::static_lambda<int(int), 32> moved = static_cast<gtl::static_lambda<int(int), 32>&&>(function);
+                  testbench::do_not_optimise_away(moved(static_cast<int>(iteration)));
+              }
+          }));
+
+    PRINT("lambda small:         %f\n", testbench::benchmark([&]() {
+              for (unsigned long long int iteration = 0; iteration < iterations; ++iteration) {
+                  gtl::lambda<int(int)> function = [small_capture](int value) { return value + small_capture[0] + small_capture[1]; };
+                  gtl::lambda<int(int)> moved = static_cast<gtl::lambda<int(int)>&&>(function);
+                  testbench::do_not_optimise_away(moved(static_cast<int>(iteration)));
+              }
+          }));
+
+    PRINT("std::function large:  %f\n", testbench::benchmark([&]() {
+              for (unsigned long long int iteration = 0; iteration < iterations; ++iteration) {
+                  std::function<int(int)> function = [large_capture](int value) { return value + large_capture[0] + large_capture[31]; };
+                  std::function<int(int)> moved = std::move(function);
+                  testbench::do_not_optimise_away(moved(static_cast<int>(iteration)));
+              }
+          }));
+
+    PRINT("lambda large:         %f\n", testbench::benchmark([&]() {
+              for (unsigned long long int iteration = 0; iteration < iterations; ++iteration) {
+                  gtl::lambda<int(int)> function = [large_capture](int value) { return value + large_capture[0] + large_capture[31]; };
+                  gtl::lambda<int(int)> moved = static_cast<gtl::lambda<int(int)>&&>(function);
+                  testbench::do_not_optimise_away(moved(static_cast<int>(iteration)));
+              }
+          }));
+}
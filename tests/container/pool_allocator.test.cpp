@@ -0,0 +1,197 @@
+/*
+Copyright (C) 2018-2024 Geoffrey Daniels. https://gpdaniels.com/
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, version 3 of the License only.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <testbench/main.tests.hpp>
+
+#include <testbench/benchmark.tests.hpp>
+#include <testbench/optimise.tests.hpp>
+#include <testbench/require.tests.hpp>
+
+#include <container/pool_allocator>
+
+#if defined(_MSC_VER)
+#pragma warning(push, 0)
+#endif
+
+#include <condition_variable>
+#include <list>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+
+TEST(pool_allocator, traits, standard) {
+    REQUIRE((std::is_empty<gtl::pool_allocator<int>>::value == true), "Expected std::is_empty to be true.");
+    REQUIRE((std::is_trivially_copyable<gtl::pool_allocator<int>>::value == true), "Expected std::is_trivially_copyable to be true.");
+}
+
+TEST(pool_allocator, function, allocate) {
+    gtl::pool_allocator<double> allocator;
+    double* first = allocator.allocate(1);
+    double* second = allocator.allocate(1);
+    REQUIRE(first != second);
+    REQUIRE((reinterpret_cast<unsigned long long int>(first) % alignof(double)) == 0);
+    REQUIRE(gtl::pool_allocator<double>::reserved() > 0);
+    allocator.deallocate(second, 1);
+    // The most recently freed block is reused first.
+    double* third = allocator.allocate(1);
+    REQUIRE(third == second);
+    allocator.deallocate(third, 1);
+    allocator.deallocate(first, 1);
+
+    // Arrays are not pooled.
+    double* array = allocator.allocate(100);
+    array[99] = 1.0;
+    allocator.deallocate(array, 100);
+}
+
+TEST(pool_allocator, function, containers) {
+    std::list<int, gtl::pool_allocator<int>> list;
+    std::map<int, int, std::less<int>, gtl::pool_allocator<std::pair<const int, int>>> map;
+    std::vector<int, gtl::pool_allocator<int>> vector;
+    for (int index = 0; index < 1000; ++index) {
+        list.push_back(index);
+        map[index] = index * 2;
+        vector.push_back(index);
+    }
+    REQUIRE(list.size() == 1000);
+    REQUIRE(map[500] == 1000);
+    REQUIRE(vector[999] == 999);
+}
+
+TEST(pool_allocator, function, threads) {
+    // Blocks allocated on one thread may be freed on another.
+    std::vector<int*> pointers;
+    std::thread producer([&pointers]() {
+        gtl::pool_allocator<int> allocator;
+        for (int index = 0; index < 1000; ++index) {
+            pointers.push_back(allocator.allocate(1));
+            *pointers.back() = index;
+        }
+    });
+    producer.join();
+    gtl::pool_allocator<int> allocator;
+    for (int index = 0; index < 1000; ++index) {
+        REQUIRE(*pointers[static_cast<unsigned long long int>(index)] == index);
+        allocator.deallocate(pointers[static_cast<unsigned long long int>(index)], 1);
+    }
+}
+
+TEST(pool_allocator, function, handoff) {
+    // Blocks repeatedly allocated on one thread and freed on another must be recycled rather than growing the pool forever.
+    struct handoff_block final {
+        unsigned long long int values[6];
+    };
+    constexpr static const unsigned long long int rounds = 100;
+    constexpr static const unsigned long long int round_size = 4096;
+
+    std::mutex mutex;
+    std::condition_variable signal;
+    std::vector<handoff_block*> pending;
+    bool done = false;
+    std::thread consumer([&]() {
+        gtl::pool_allocator<handoff_block> allocator;
+        std::unique_lock<std::mutex> lock(mutex);
+        while (!done) {
+            signal.wait(lock, [&]() {
+                return !pending.empty() || done;
+            });
+            for (handoff_block* pointer : pending) {
+                allocator.deallocate(pointer, 1);
+            }
+            pending.clear();
+            signal.notify_all();
+        }
+    });
+
+    gtl::pool_allocator<handoff_block> allocator;
+    std::vector<handoff_block*> blocks;
+    for (unsigned long long int round = 0; round < rounds; ++round) {
+        for (unsigned long long int index = 0; index < round_size; ++index) {
+            blocks.push_back(allocator.allocate(1));
+            blocks.back()->values[0] = index;
+        }
+        std::unique_lock<std::mutex> lock(mutex);
+        pending.swap(blocks);
+        signal.notify_all();
+        signal.wait(lock, [&]() {
+            return pending.empty();
+        });
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        done = true;
+        signal.notify_all();
+    }
+    consumer.join();
+
+    REQUIRE(gtl::pool_allocator<handoff_block>::reserved() < 16 * round_size * sizeof(handoff_block));
+}
+
+TEST(pool_allocator, function, thread_exit) {
+    // Blocks left on the free list of an exiting thread must be reused by later threads rather than growing the pool forever.
+    struct thread_exit_block final {
+        unsigned long long int values[5];
+    };
+    constexpr static const unsigned long long int thread_count = 100;
+    constexpr static const unsigned long long int thread_blocks = 500;
+
+    unsigned long long int reserved_first = 0;
+    for (unsigned long long int thread = 0; thread < thread_count; ++thread) {
+        std::thread worker([]() {
+            gtl::pool_allocator<thread_exit_block> allocator;
+            std::vector<thread_exit_block*> blocks;
+            for (unsigned long long int index = 0; index < thread_blocks; ++index) {
+                blocks.push_back(allocator.allocate(1));
+                blocks.back()->values[0] = index;
+            }
+            for (thread_exit_block* pointer : blocks) {
+                allocator.deallocate(pointer, 1);
+            }
+        });
+        worker.join();
+        if (thread == 0) {
+            reserved_first = gtl::pool_allocator<thread_exit_block>::reserved();
+        }
+    }
+
+    REQUIRE(gtl::pool_allocator<thread_exit_block>::reserved() == reserved_first, "Expected the pool to stay at %llu bytes, not grow to %llu bytes.", reserved_first, gtl::pool_allocator<thread_exit_block>::reserved());
+}
+
+TEST(pool_allocator, evaluate, benchmark) {
+    constexpr static const int size = 10000;
+
+    PRINT("std::allocator:       %f\n", testbench::benchmark([&]() {
+              std::map<int, int> map;
+              for (int index = 0; index < size; ++index) {
+                  map[index] = index;
+              }
+              testbench::do_not_optimise_away(map);
+          }, 100));
+
+    PRINT("gtl::pool_allocator:  %f\n", testbench::benchmark([&]() {
+              std::map<int, int, std::less<int>, gtl::pool_allocator<std::pair<const int, int>>> map;
+              for (int index = 0; index < size; ++index) {
+                  map[index] = index;
+              }
+              testbench::do_not_optimise_away(map);
+          }, 100));
+}
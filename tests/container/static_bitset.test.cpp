@@ -0,0 +1,123 @@
+/*
+Copyright (C) 2018-2024 Geoffrey Daniels. https://gpdaniels.com/
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, version 3 of the License only.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <testbench/main.tests.hpp>
+
+#include <testbench/benchmark.tests.hpp>
+#include <testbench/optimise.tests.hpp>
+#include <testbench/require.tests.hpp>
+
+#include <container/static_bitset>
+
+#if defined(_MSC_VER)
+#pragma warning(push, 0)
+#endif
+
+#include <bitset>
+#include <type_traits>
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+
+TEST(static_bitset, traits, standard) {
+    REQUIRE((std::is_pod<gtl::static_bitset<100>>::value == true), "Expected std::is_pod to be true.");
+    REQUIRE((std::is_trivially_copyable<gtl::static_bitset<100>>::value == true), "Expected std::is_trivially_copyable to be true.");
+    REQUIRE((sizeof(gtl::static_bitset<64>) == 8), "Expected a 64 bit static_bitset to use one word.");
+    REQUIRE((sizeof(gtl::static_bitset<65>) == 16), "Expected a 65 bit static_bitset to use two words.");
+}
+
+TEST(static_bitset, function, bits) {
+    gtl::static_bitset<81> bits = {};
+    REQUIRE(bits.size() == 81);
+    REQUIRE(bits.none());
+    bits.set(3);
+    bits.set(80);
+    REQUIRE(bits.count() == 2);
+    REQUIRE(bits.find_first() == 3);
+    REQUIRE(bits.find_next(4) == 80);
+    unsigned long long int sum = 0;
+    for (unsigned long long int index : bits) {
+        sum += index;
+    }
+    REQUIRE(sum == 83);
+    bits.flip();
+    REQUIRE(bits.count() == 79);
+    bits.set();
+    REQUIRE(bits.all());
+    REQUIRE(bits.data()[1] == 0x1FFFF);
+    bits.reset();
+    REQUIRE(bits.none());
+    REQUIRE(bits.find_first() == 81);
+}
+
+TEST(static_bitset, function, operators) {
+    gtl::static_bitset<128> lhs = {};
+    gtl::static_bitset<128> rhs = {};
+    for (unsigned long long int index = 0; index < 128; ++index) {
+        lhs.set(index, (index % 2) == 0);
+        rhs.set(index, (index % 4) == 0);
+    }
+    REQUIRE((lhs & rhs) == rhs);
+    REQUIRE((lhs | rhs) == lhs);
+    REQUIRE((lhs ^ rhs).count() == 32);
+    gtl::static_bitset<128> difference = lhs;
+    difference.and_not(rhs);
+    REQUIRE(difference.count() == 32);
+    REQUIRE(difference.intersects(rhs) == false);
+    REQUIRE((~lhs).count() == 64);
+}
+
+TEST(static_bitset, evaluate, benchmark) {
+    constexpr static const unsigned long long int size = 4096;
+    std::bitset<size> std_lhs;
+    std::bitset<size> std_rhs;
+    gtl::static_bitset<size> gtl_lhs = {};
+    gtl::static_bitset<size> gtl_rhs = {};
+    for (unsigned long long int index = 0; index < size; ++index) {
+        std_lhs.set(index, (index % 3) == 0);
+        std_rhs.set(index, (index % 7) == 0);
+        gtl_lhs.set(index, (index % 3) == 0);
+        gtl_rhs.set(index, (index % 7) == 0);
+    }
+
+    unsigned long long int std_total = 0;
+    unsigned long long int gtl_total = 0;
+
+    PRINT("std::bitset:       %f\n", testbench::benchmark([&]() {
+              std_total = 0;
+              std::bitset<size> result = std_lhs;
+              for (unsigned long long int index = 0; index < size; ++index) {
+                  std_total += (std_lhs & std_rhs).count();
+                  result ^= std_rhs;
+              }
+              testbench::do_not_optimise_away(std_total);
+              testbench::do_not_optimise_away(result);
+          }, 10));
+
+    PRINT("gtl::static_bitset: %f\n", testbench::benchmark([&]() {
+              gtl_total = 0;
+              gtl::static_bitset<size> result = gtl_lhs;
+              for (unsigned long long int index = 0; index < size; ++index) {
+                  gtl_total += (gtl_lhs & gtl_rhs).count();
+                  result ^= gtl_rhs;
+              }
+              testbench::do_not_optimise_away(gtl_total);
+              testbench::do_not_optimise_away(result);
+          }, 10));
+
+    REQUIRE(std_total == gtl_total);
+}
@@ -16,6 +16,7 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 #include <testbench/main.tests.hpp>
 
+#include <testbench/benchmark.tests.hpp>
 #include <testbench/comparison.tests.hpp>
 #include <testbench/optimise.tests.hpp>
 #include <testbench/require.tests.hpp>
@@ -28,6 +29,7 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #endif
 
 #include <type_traits>
+#include <variant>
 
 #if defined(_MSC_VER)
 #pragma warning(pop)
@@ -39,14 +41,15 @@ TEST(static_variant, traits, standard) {
             using type1 = typename decltype(test_type_1)::type;
             REQUIRE((std::is_pod<gtl::static_variant<type1>>::value == false), "Expected std::is_pod to be false.");
             REQUIRE((std::is_trivial<gtl::static_variant<type1>>::value == false), "Expected std::is_trivial to be false.");
-            REQUIRE((std::is_trivially_copyable<gtl::static_variant<type1>>::value == false), "Expected std::is_trivially_copyable to be false.");
+            REQUIRE((std::is_trivially_copyable<gtl::static_variant<type1>>::value == true), "Expected std::is_trivially_copyable to be true.");
             REQUIRE((std::is_standard_layout<gtl::static_variant<type1>>::value == true), "Expected std::is_standard_layout to be true.");
+            REQUIRE(sizeof(gtl::static_variant<type1>) <= 2 * sizeof(type1) + (sizeof(type1) == 1), "Expected the static_variant to be no larger than its type plus an aligned index.");
             testbench::test_template<testbench::test_types>(
                 [](auto test_type_2) -> void {
                     using type2 = typename decltype(test_type_2)::type;
                     REQUIRE((std::is_pod<gtl::static_variant<type1, type2>>::value == false), "Expected std::is_pod to be false.");
                     REQUIRE((std::is_trivial<gtl::static_variant<type1, type2>>::value == false), "Expected std::is_trivial to be false.");
-                    REQUIRE((std::is_trivially_copyable<gtl::static_variant<type1, type2>>::value == false), "Expected std::is_trivially_copyable to be false.");
+                    REQUIRE((std::is_trivially_copyable<gtl::static_variant<type1, type2>>::value == true), "Expected std::is_trivially_copyable to be true.");
                     REQUIRE((std::is_standard_layout<gtl::static_variant<type1, type2>>::value == true), "Expected std::is_standard_layout to be true.");
                 }
             );
@@ -141,3 +144,166 @@ TEST(static_variant, function, set) {
     REQUIRE(testbench::is_value_equal(static_variant_i.get<int>(), 4321));
     REQUIRE(testbench::is_value_equal(static_variant_f.get<float>(), 0.1f));
 }
+
+namespace {
+    struct lifetime_counter final {
+        static int constructions;
+        static int destructions;
+
+        int value;
+
+        lifetime_counter(int value_)
+            : value(value_) {
+            ++lifetime_counter::constructions;
+        }
+
+        lifetime_counter(const lifetime_counter& other)
+            : value(other.value) {
+            ++lifetime_counter::constructions;
+        }
+
+        lifetime_counter& operator=(const lifetime_counter& other) = default;
+
+        ~lifetime_counter() {
+            ++lifetime_counter::destructions;
+        }
+    };
+
+    int lifetime_counter::constructions = 0;
+    int lifetime_counter::destructions = 0;
+}
+
+TEST(static_variant, function, index) {
+    gtl::static_variant<int, float, double> static_variant_i(1234);
+    gtl::static_variant<int, float, double> static_variant_d(1.0);
+
+    REQUIRE((gtl::static_variant<int, float, double>::type_count() == 3));
+    REQUIRE(static_variant_i.index() == 0);
+    REQUIRE(static_variant_d.index() == 2);
+    REQUIRE(testbench::is_value_equal(static_variant_i.get_at<0>(), 1234));
+    REQUIRE(testbench::is_value_equal(static_variant_d.get_at<2>(), 1.0));
+    REQUIRE(static_variant_d.is<char>() == false);
+}
+
+TEST(static_variant, function, lifetime) {
+    lifetime_counter::constructions = 0;
+    lifetime_counter::destructions = 0;
+    {
+        REQUIRE((std::is_trivially_copyable<gtl::static_variant<int, lifetime_counter>>::value == false));
+        gtl::static_variant<int, lifetime_counter> variant1(lifetime_counter(1));
+        gtl::static_variant<int, lifetime_counter> variant2(variant1);
+        gtl::static_variant<int, lifetime_counter> variant3(static_cast<gtl::static_variant<int, lifetime_counter>&&>(variant2));
+        REQUIRE(variant3.get<lifetime_counter>().value == 1);
+        variant1.set<int>(2);
+        REQUIRE(variant1.get<int>() == 2);
+        variant1 = variant3;
+        REQUIRE(variant1.get<lifetime_counter>().value == 1);
+        variant3 = gtl::static_variant<int, lifetime_counter>(3);
+        REQUIRE(variant3.get<int>() == 3);
+    }
+    REQUIRE(lifetime_counter::constructions == lifetime_counter::destructions);
+}
+
+TEST(static_variant, function, visit) {
+    gtl::static_variant<int, float, char> static_variant_i(1234);
+    gtl::static_variant<int, float, char> static_variant_c('a');
+
+    struct visitor final {
+        int operator()(int value) const {
+            return value;
+        }
+        int operator()(float value) const {
+            return static_cast<int>(value) + 1000;
+        }
+        int operator()(char value) const {
+            return static_cast<int>(value) + 2000;
+        }
+    };
+
+    REQUIRE(static_variant_i.visit(visitor()) == 1234);
+    REQUIRE(static_variant_c.visit(visitor()) == 'a' + 2000);
+    REQUIRE(gtl::visit(visitor(), static_variant_c) == 'a' + 2000);
+
+    static_variant_i.visit([](auto& value) {
+        value += 1;
+    });
+    REQUIRE(static_variant_i.get<int>() == 1235);
+}
+
+TEST(static_variant, function, visit_multiple) {
+    gtl::static_variant<int, double> lhs_i(2);
+    gtl::static_variant<int, double> lhs_d(0.5);
+    const gtl::static_variant<char, int, float> rhs_c(static_cast<char>(3));
+    const gtl::static_variant<char, int, float> rhs_f(4.0f);
+
+    const auto multiply = [](const auto& lhs, const auto& rhs) -> double {
+        return static_cast<double>(lhs) * static_cast<double>(rhs);
+    };
+
+    REQUIRE(testbench::is_value_equal(gtl::visit(multiply, lhs_i, rhs_c), 6.0));
+    REQUIRE(testbench::is_value_equal(gtl::visit(multiply, lhs_i, rhs_f), 8.0));
+    REQUIRE(testbench::is_value_equal(gtl::visit(multiply, lhs_d, rhs_c), 1.5));
+    REQUIRE(testbench::is_value_equal(gtl::visit(multiply, lhs_d, rhs_f), 2.0));
+
+    const auto add = [](const auto& first, const auto& second, const auto& third) -> double {
+        return static_cast<double>(first) + static_cast<double>(second) + static_cast<double>(third);
+    };
+    REQUIRE(testbench::is_value_equal(gtl::visit(add, lhs_d, rhs_f, gtl::static_variant<int, double>(1)), 5.5));
+}
+
+TEST(static_variant, evaluate, benchmark) {
+    constexpr static const unsigned long long int size = 1 << 12;
+    gtl::static_variant<int, float, double, char>* gtl_variants = new gtl::static_variant<int, float, double, char>[size];
+    std::variant<int, float, double, char>* std_variants = new std::variant<int, float, double, char>[size];
+    for (unsigned long long int index = 0; index < size; ++index) {
+        switch (index % 4) {
+            case 0:
+                gtl_variants[index] = static_cast<int>(index);
+                std_variants[index] = static_cast<int>(index);
+                break;
+            case 1:
+                gtl_variants[index] = static_cast<float>(index);
+                std_variants[index] = static_cast<float>(index);
+                break;
+            case 2:
+                gtl_variants[index] = static_cast<double>(index);
+                std_variants[index] = static_cast<double>(index);
+                break;
+            default:
+                gtl_variants[index] = static_cast<char>(index);
+                std_variants[index] = static_cast<char>(index);
+                break;
+        }
+    }
+
+    const auto sum = [](const auto& value) -> double {
+        return static_cast<double>(value);
+    };
+
+    double gtl_total = 0.0;
+    double std_total = 0.0;
+
+    PRINT("std::visit: %f\n", testbench::benchmark([&]() {
+              std_total = 0.0;
+              for (unsigned long long int index = 0; index < size; ++index) {
+                  std_total += std::visit(sum, std_variants[index]);
+              }
+              testbench::do_not_optimise_away(std_total);
+          }, 1000));
+
+    PRINT("gtl::visit: %f\n", testbench::benchmark([&]() {
+              gtl_total = 0.0;
+              for (unsigned long long int index = 0; index < size; ++index) {
+                  gtl_total += gtl::visit(sum, gtl_variants[index]);
+              }
+              testbench::do_not_optimise_away(gtl_total);
+          }, 1000));
+
+    PRINT("std::variant size: %llu\n", static_cast<unsigned long long int>(sizeof(std::variant<int, float, double, char>)));
+    PRINT("gtl::static_variant size: %llu\n", static_cast<unsigned long long int>(sizeof(gtl::static_variant<int, float, double, char>)));
+
+    REQUIRE(testbench::is_value_equal(gtl_total, std_total));
+
+    delete[] gtl_variants;
+    delete[] std_variants;
+}
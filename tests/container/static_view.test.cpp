@@ -305,3 +305,126 @@ TEST(static_view, operator, parenthesis) {
         }
     );
 }
+
+TEST(static_view, function, stride) {
+    int buffer[6 * 8]{};
+    gtl::static_view<int, 6, 8> contiguous(&buffer[0]);
+    REQUIRE(contiguous.stride(0) == 8);
+    REQUIRE(contiguous.stride(1) == 1);
+    REQUIRE(contiguous.is_contiguous());
+
+    gtl::static_view<int, 6, 5> padded(&buffer[0], 8, 1);
+    REQUIRE(padded.stride(0) == 8);
+    REQUIRE(padded.stride(1) == 1);
+    REQUIRE(!padded.is_contiguous());
+    for (unsigned int y = 0; y < 6; ++y) {
+        for (unsigned int x = 0; x < 5; ++x) {
+            padded(y, x) = static_cast<int>(y * 10 + x);
+        }
+    }
+    for (unsigned int y = 0; y < 6; ++y) {
+        for (unsigned int x = 0; x < 8; ++x) {
+            REQUIRE(buffer[y * 8 + x] == ((x < 5) ? static_cast<int>(y * 10 + x) : 0));
+        }
+    }
+    REQUIRE(padded.data() == &buffer[0]);
+    REQUIRE(padded[2].data() == &buffer[16]);
+    REQUIRE(padded[2].stride(0) == 1);
+}
+
+TEST(static_view, function, row_stride) {
+    int buffer[6 * 8]{};
+    gtl::static_view<int, 6, 8> contiguous(&buffer[0]);
+    REQUIRE(contiguous.row_stride() == 8);
+
+    gtl::static_view<int, 3, 4> region = contiguous.region<3, 4>(1, 2);
+    REQUIRE(region.row_stride() == 8);
+
+    auto rows = contiguous.step<0, 2>();
+    REQUIRE(rows.row_stride() == 16);
+
+    // A single column has no adjacent elements so any column stride can be addressed by a row stride.
+    auto column = contiguous.transpose<0, 1>().region<8, 1>(0, 3);
+    REQUIRE(column.row_stride() == 1);
+    REQUIRE(column.data() == &buffer[3 * 8]);
+}
+
+TEST(static_view, function, region) {
+    int buffer[6 * 8]{};
+    for (unsigned int index = 0; index < 6 * 8; ++index) {
+        buffer[index] = static_cast<int>(index);
+    }
+    gtl::static_view<int, 6, 8> image(&buffer[0]);
+
+    gtl::static_view<int, 3, 4> region = image.region<3, 4>(2, 3);
+    REQUIRE(region.data() == &buffer[2 * 8 + 3]);
+    REQUIRE(region.stride(0) == 8);
+    REQUIRE(region.stride(1) == 1);
+    for (unsigned int y = 0; y < 3; ++y) {
+        for (unsigned int x = 0; x < 4; ++x) {
+            REQUIRE(region(y, x) == image(y + 2, x + 3));
+        }
+    }
+
+    region(0, 0) = -1;
+    REQUIRE(buffer[2 * 8 + 3] == -1);
+
+    gtl::static_view<int, 1, 2> nested = region.region<1, 2>(2, 2);
+    REQUIRE(nested(0, 0) == image(4, 5));
+    REQUIRE(nested(0, 1) == image(4, 6));
+}
+
+TEST(static_view, function, step) {
+    int buffer[5 * 7]{};
+    for (unsigned int index = 0; index < 5 * 7; ++index) {
+        buffer[index] = static_cast<int>(index);
+    }
+    gtl::static_view<int, 5, 7> image(&buffer[0]);
+
+    auto rows = image.step<0, 2>();
+    static_assert(decltype(rows)::size(0) == 3, "Expected the stepped dimension to round up.");
+    static_assert(decltype(rows)::size(1) == 7, "Expected the other dimension to be unchanged.");
+    REQUIRE(rows.stride(0) == 14);
+    for (unsigned int y = 0; y < 3; ++y) {
+        for (unsigned int x = 0; x < 7; ++x) {
+            REQUIRE(rows(y, x) == image(y * 2, x));
+        }
+    }
+
+    // Decimating both dimensions gives the next level of an image pyramid without a copy.
+    auto half = image.step<0, 2>().step<1, 2>();
+    static_assert(decltype(half)::size(0) == 3, "Expected the stepped dimension to round up.");
+    static_assert(decltype(half)::size(1) == 4, "Expected the stepped dimension to round up.");
+    for (unsigned int y = 0; y < 3; ++y) {
+        for (unsigned int x = 0; x < 4; ++x) {
+            REQUIRE(half(y, x) == image(y * 2, x * 2));
+        }
+    }
+    REQUIRE(!half.is_contiguous());
+}
+
+TEST(static_view, function, transpose) {
+    int buffer[2 * 3 * 4]{};
+    for (unsigned int index = 0; index < 2 * 3 * 4; ++index) {
+        buffer[index] = static_cast<int>(index);
+    }
+    gtl::static_view<int, 2, 3, 4> volume(&buffer[0]);
+
+    auto transposed = volume.transpose<0, 2>();
+    static_assert(decltype(transposed)::size(0) == 4, "Expected the dimension sizes to be swapped.");
+    static_assert(decltype(transposed)::size(1) == 3, "Expected the dimension sizes to be unchanged.");
+    static_assert(decltype(transposed)::size(2) == 2, "Expected the dimension sizes to be swapped.");
+    REQUIRE(transposed.stride(0) == 1);
+    REQUIRE(transposed.stride(2) == 12);
+    for (unsigned int z = 0; z < 2; ++z) {
+        for (unsigned int y = 0; y < 3; ++y) {
+            for (unsigned int x = 0; x < 4; ++x) {
+                REQUIRE(transposed(x, y, z) == volume(z, y, x));
+            }
+        }
+    }
+
+    auto restored = transposed.transpose<2, 0>();
+    REQUIRE(restored.is_contiguous());
+    REQUIRE(restored(1, 2, 3) == volume(1, 2, 3));
+}
@@ -27,7 +27,9 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #pragma warning(push, 0)
 #endif
 
+#include <memory>
 #include <type_traits>
+#include <vector>
 
 #if defined(_MSC_VER)
 #pragma warning(pop)
@@ -141,6 +143,23 @@ TEST(coroutine, function, current_yield) {
     REQUIRE(result == 2, "Expected result to be set to 2 not '%d' after coroutine run.", result);
 }
 
+TEST(coroutine, function, current_yield_move) {
+    int result = 0;
+    std::vector<int> values = { 1, 2, 3 };
+    std::unique_ptr<gtl::coroutine> coroutine1(new gtl::coroutine([&result, values]() {
+        result = values[0];
+        gtl::this_coroutine::yield();
+        result = values[2];
+    }));
+    coroutine1->join();
+    REQUIRE(result == 1, "Expected result to be set to 1 not '%d' after coroutine yield.", result);
+    // Move the started coroutine and destroy the original, the function it is running must stay in place.
+    gtl::coroutine coroutine2(std::move(*coroutine1));
+    coroutine1.reset();
+    coroutine2.join();
+    REQUIRE(result == 3, "Expected result to be set to 3 not '%d' after coroutine run.", result);
+}
+
 TEST(coroutine, function, current_sleep_for) {
     gtl::coroutine coroutine([]() {
         gtl::this_coroutine::sleep_for(std::chrono::milliseconds(100));
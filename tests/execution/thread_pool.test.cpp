@@ -73,6 +73,12 @@ TEST(thread_pool, constructor, number) {
     }
 }
 
+TEST(thread_pool, function, size) {
+    gtl::thread_pool thread_pool(3);
+    REQUIRE(thread_pool.size() == 3);
+    thread_pool.join();
+}
+
 TEST(thread_pool, function, push_job) {
     {
         gtl::thread_pool thread_pool = gtl::thread_pool();
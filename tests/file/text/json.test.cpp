@@ -22,11 +22,20 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 #include <file/text/json>
 
+#include <container/arena>
+#include <container/pool_allocator>
+
 #if defined(_MSC_VER)
 #pragma warning(push, 0)
 #endif
 
+#include <cstring>
+#include <map>
+#include <memory>
+#include <string>
+#include <string_view>
 #include <type_traits>
+#include <vector>
 
 #if defined(_MSC_VER)
 #pragma warning(pop)
@@ -43,6 +52,9 @@ TEST(json, traits, standard) {
     // Unreliable.
     REQUIRE((std::is_standard_layout<gtl::json>::value == false));
 #endif
+
+    REQUIRE((std::is_same<gtl::json::value::object_type, std::map<std::string, gtl::json::value>>::value));
+    REQUIRE((std::is_same<gtl::json::value::array_type, std::vector<gtl::json::value>>::value));
 }
 
 TEST(json, constructor, empty) {
@@ -72,6 +84,32 @@ TEST(json, function, parse) {
     }
 }
 
+constexpr static const char* invalid_strings[] = {
+    R"()",
+    R"( )",
+    R"(")",
+    R"("hello)",
+    R"({)",
+    R"({"a")",
+    R"({"a":)",
+    R"({"a":})",
+    R"({"a":null,)",
+    R"([)",
+    R"([null,)",
+    R"([null,])",
+};
+
+TEST(json, function, parse_invalid) {
+    gtl::json json;
+    for (const char* string : invalid_strings) {
+        // Copy into an exactly sized buffer, so reading past the end of the input is detected.
+        const std::size_t length = std::strlen(string);
+        std::unique_ptr<char[]> buffer(new char[length > 0 ? length : 1]);
+        std::memcpy(buffer.get(), string, length);
+        REQUIRE(!json.parse(std::string_view(buffer.get(), length)), "Expected parsing invalid json to fail: %s", string);
+    }
+}
+
 TEST(json, function, compose) {
     gtl::json json;
     for (const char* string : valid_strings) {
@@ -79,3 +117,18 @@ TEST(json, function, compose) {
         REQUIRE(testbench::is_string_same(json.compose().c_str(), string), "Failed to compose json: parse(%s) != %s", string, json.compose().c_str());
     }
 }
+
+TEST(json, function, compose_allocators) {
+    gtl::basic_json<gtl::pool_allocator<char>> pool_json;
+    for (const char* string : valid_strings) {
+        REQUIRE(pool_json.parse(string), "Failed to parse json: %s", string);
+        REQUIRE(testbench::is_string_same(pool_json.compose().c_str(), string), "Failed to compose json: parse(%s) != %s", string, pool_json.compose().c_str());
+    }
+
+    gtl::arena arena;
+    gtl::basic_json<gtl::arena_allocator<char>> arena_json{ gtl::arena_allocator<char>(arena) };
+    for (const char* string : valid_strings) {
+        REQUIRE(arena_json.parse(string), "Failed to parse json: %s", string);
+        REQUIRE(testbench::is_string_same(arena_json.compose().c_str(), string), "Failed to compose json: parse(%s) != %s", string, arena_json.compose().c_str());
+    }
+}
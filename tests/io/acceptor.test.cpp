@@ -0,0 +1,189 @@
+/*
+Copyright (C) 2018-2024 Geoffrey Daniels. https://gpdaniels.com/
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, version 3 of the License only.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <testbench/main.tests.hpp>
+
+#include <testbench/benchmark.tests.hpp>
+#include <testbench/require.tests.hpp>
+
+#include <io/acceptor>
+
+#if defined(_MSC_VER)
+#pragma warning(push, 0)
+#endif
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+
+namespace {
+    /// @brief Wait for a count to reach a value, so tests do not hang if connections are lost.
+    bool wait_for(const std::atomic<unsigned long long int>& count, unsigned long long int value) {
+        for (int attempt = 0; attempt < 5000; ++attempt) {
+            if (count.load() >= value) {
+                return true;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return false;
+    }
+}
+
+TEST(acceptor, traits, standard) {
+    REQUIRE((std::is_pod<gtl::acceptor>::value == false));
+
+    REQUIRE((std::is_trivial<gtl::acceptor>::value == false));
+
+    REQUIRE((std::is_trivially_copyable<gtl::acceptor>::value == false));
+
+    REQUIRE((std::is_copy_constructible<gtl::acceptor>::value == false));
+}
+
+TEST(acceptor, constructor, parameterised) {
+    gtl::thread_pool pool(3);
+    {
+        gtl::acceptor acceptor(pool, gtl::socket::tcp_server{ gtl::socket::ip_any, gtl::socket::port_any }, [](gtl::socket&, gtl::socket::ip, unsigned short) {});
+        REQUIRE(acceptor.is_open());
+        REQUIRE(acceptor.size() == 3);
+        REQUIRE(acceptor.get_port() != 0);
+        REQUIRE(acceptor.accepted() == 0);
+    }
+    pool.join();
+}
+
+TEST(acceptor, function, accept) {
+    gtl::thread_pool pool(4);
+    std::atomic<unsigned long long int> called(0);
+    std::atomic<int> failures(0);
+    gtl::acceptor acceptor(pool, gtl::socket::tcp_server{ gtl::socket::ip_any, gtl::socket::port_any }, [&](gtl::socket& connection, gtl::socket::ip address, unsigned short port) {
+        if (!connection.is_open() || (address.segment[0] != 127) || (port == 0)) {
+            ++failures;
+        }
+        ++called;
+    }, 2);
+    REQUIRE(acceptor.is_open());
+    REQUIRE(acceptor.size() == 2);
+
+    constexpr static const int connection_count = 100;
+    std::vector<gtl::socket> clients(connection_count);
+    for (gtl::socket& client : clients) {
+        REQUIRE(client.open(gtl::socket::tcp_client{ gtl::socket::ip_any, gtl::socket::port_any, gtl::socket::ip_loopback, acceptor.get_port() }));
+    }
+    REQUIRE(wait_for(called, connection_count));
+    REQUIRE(acceptor.accepted() == connection_count);
+    REQUIRE(failures == 0);
+
+    acceptor.stop();
+    pool.join();
+}
+
+TEST(acceptor, function, keep_connection) {
+    gtl::thread_pool pool(2);
+    gtl::socket kept;
+    std::atomic<unsigned long long int> called(0);
+    gtl::acceptor acceptor(pool, gtl::socket::tcp_server{ gtl::socket::ip_any, gtl::socket::port_any }, [&](gtl::socket& connection, gtl::socket::ip, unsigned short) {
+        kept = std::move(connection);
+        ++called;
+    }, 1, true);
+
+    gtl::socket client;
+    REQUIRE(client.open(gtl::socket::tcp_client{ gtl::socket::ip_any, gtl::socket::port_any, gtl::socket::ip_loopback, acceptor.get_port() }));
+    REQUIRE(wait_for(called, 1));
+    REQUIRE(kept.is_open());
+
+    // The connection was accepted non-blocking.
+    unsigned char buffer[16] = {};
+    REQUIRE(recv(kept.get_handle(), reinterpret_cast<char*>(buffer), sizeof(buffer), 0) < 0);
+
+    const unsigned char message[] = "message";
+    unsigned long long int length = sizeof(message);
+    REQUIRE(client.write(message, length));
+    REQUIRE(length == sizeof(message));
+    REQUIRE(kept.read_exact(buffer, length));
+    REQUIRE(length == sizeof(message));
+
+    acceptor.stop();
+    pool.join();
+}
+
+TEST(acceptor, function, stop) {
+    gtl::thread_pool pool(2);
+    gtl::acceptor acceptor(pool, gtl::socket::tcp_server{ gtl::socket::ip_any, gtl::socket::port_any }, [](gtl::socket&, gtl::socket::ip, unsigned short) {});
+    const unsigned short port = acceptor.get_port();
+    acceptor.stop();
+    REQUIRE(!acceptor.is_open());
+    acceptor.stop();
+
+    // Once stopped the port is free and nothing is listening.
+    gtl::socket client;
+    REQUIRE(!client.open(gtl::socket::tcp_client{ gtl::socket::ip_any, gtl::socket::port_any, gtl::socket::ip_loopback, port }));
+
+    // The pool threads are free for other work.
+    std::atomic<int> value(0);
+    gtl::thread_pool::queue queue(pool);
+    queue.push([&value]() {
+        value = 1;
+    });
+    queue.drain();
+    REQUIRE(value == 1);
+
+    pool.join();
+}
+
+TEST(acceptor, evaluate, connections) {
+    constexpr static const int connection_count = 1000;
+    constexpr static const int client_count = 4;
+    for (unsigned int shards : { 1u, 4u }) {
+        gtl::thread_pool pool(4 + client_count);
+        std::atomic<unsigned long long int> called(0);
+        gtl::acceptor acceptor(pool, gtl::socket::tcp_server{ gtl::socket::ip_any, gtl::socket::port_any }, [&called](gtl::socket&, gtl::socket::ip, unsigned short) {
+            ++called;
+        }, shards);
+        REQUIRE(acceptor.is_open());
+
+        std::atomic<int> failures(0);
+        PRINT("Connect %d clients from %d threads to %u shards: %f\n", connection_count, client_count, shards, testbench::benchmark([&]() {
+            const unsigned long long int expected = called.load() + connection_count;
+            std::vector<std::thread> threads;
+            for (int thread = 0; thread < client_count; ++thread) {
+                threads.emplace_back([&]() {
+                    for (int index = 0; index < connection_count / client_count; ++index) {
+                        gtl::socket client;
+                        if (!client.open(gtl::socket::tcp_client{ gtl::socket::ip_any, gtl::socket::port_any, gtl::socket::ip_loopback, acceptor.get_port() })) {
+                            ++failures;
+                        }
+                    }
+                });
+            }
+            for (std::thread& thread : threads) {
+                thread.join();
+            }
+            if (!wait_for(called, expected)) {
+                ++failures;
+            }
+        }, 4));
+        REQUIRE(failures == 0);
+
+        acceptor.stop();
+        pool.join();
+    }
+}
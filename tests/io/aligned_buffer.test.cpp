@@ -0,0 +1,93 @@
+/*
+Copyright (C) 2018-2024 Geoffrey Daniels. https://gpdaniels.com/
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, version 3 of the License only.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <testbench/main.tests.hpp>
+
+#include <testbench/require.tests.hpp>
+
+#include <io/aligned_buffer>
+
+#if defined(_MSC_VER)
+#pragma warning(push, 0)
+#endif
+
+#include <type_traits>
+#include <utility>
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+
+TEST(aligned_buffer, traits, standard) {
+    REQUIRE((std::is_pod<gtl::aligned_buffer>::value == false));
+
+    REQUIRE((std::is_trivial<gtl::aligned_buffer>::value == false));
+
+    REQUIRE((std::is_trivially_copyable<gtl::aligned_buffer>::value == false));
+
+    REQUIRE((std::is_standard_layout<gtl::aligned_buffer>::value == true));
+}
+
+TEST(aligned_buffer, constructor, empty) {
+    gtl::aligned_buffer buffer;
+    REQUIRE(buffer.empty());
+    REQUIRE(buffer.data() == nullptr);
+    REQUIRE(buffer.size() == 0);
+    REQUIRE(buffer.alignment() == gtl::file::direct_alignment);
+}
+
+TEST(aligned_buffer, constructor, size) {
+    gtl::aligned_buffer buffer(5000);
+    REQUIRE(buffer.size() == 8192, "Expected the size to be rounded up to the alignment, not %llu.", static_cast<unsigned long long int>(buffer.size()));
+    REQUIRE(gtl::file::is_aligned(buffer.data(), buffer.size()));
+    REQUIRE(buffer.end() - buffer.begin() == 8192);
+
+    gtl::aligned_buffer small(100, 64);
+    REQUIRE(small.size() == 128);
+    REQUIRE(small.alignment() == 64);
+    REQUIRE(gtl::file::is_aligned(small.data(), small.size(), 0, 64));
+}
+
+TEST(aligned_buffer, constructor, move) {
+    gtl::aligned_buffer buffer1(4096);
+    char* data = buffer1.data();
+    data[0] = 'x';
+    gtl::aligned_buffer buffer2(std::move(buffer1));
+    REQUIRE(buffer1.empty());
+    REQUIRE(buffer2.data() == data);
+    REQUIRE(buffer2.data()[0] == 'x');
+
+    gtl::aligned_buffer buffer3(512, 512);
+    buffer3 = std::move(buffer2);
+    REQUIRE(buffer2.empty());
+    REQUIRE(buffer3.data() == data);
+    REQUIRE(buffer3.size() == 4096);
+    REQUIRE(buffer3.alignment() == gtl::file::direct_alignment);
+}
+
+TEST(aligned_buffer, function, allocate_and_release) {
+    gtl::aligned_buffer buffer;
+    buffer.allocate(1, 256);
+    REQUIRE(buffer.size() == 256);
+    REQUIRE(gtl::file::is_aligned(buffer.data(), buffer.size(), 0, 256));
+    buffer.allocate(0);
+    REQUIRE(buffer.empty());
+    buffer.allocate(10000);
+    REQUIRE(buffer.size() == 12288);
+    buffer.release();
+    REQUIRE(buffer.empty());
+    REQUIRE(buffer.data() == nullptr);
+}
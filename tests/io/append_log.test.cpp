@@ -0,0 +1,287 @@
+/*
+Copyright (C) 2018-2024 Geoffrey Daniels. https://gpdaniels.com/
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, version 3 of the License only.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <testbench/main.tests.hpp>
+
+#include <testbench/benchmark.tests.hpp>
+#include <testbench/ignored.tests.hpp>
+#include <testbench/require.tests.hpp>
+
+#include <io/files.test.hpp>
+#include <io/append_log>
+
+#if defined(_MSC_VER)
+#pragma warning(push, 0)
+#endif
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+
+namespace {
+    std::vector<std::string> split_lines(const std::string& contents) {
+        std::vector<std::string> lines;
+        std::string::size_type start = 0;
+        for (std::string::size_type end = contents.find('\n'); end != std::string::npos; end = contents.find('\n', start)) {
+            lines.push_back(contents.substr(start, end - start));
+            start = end + 1;
+        }
+        return lines;
+    }
+}
+
+TEST(append_log, traits, standard) {
+    REQUIRE((std::is_pod<gtl::append_log>::value == false));
+
+    REQUIRE((std::is_trivial<gtl::append_log>::value == false));
+
+    REQUIRE((std::is_trivially_copyable<gtl::append_log>::value == false));
+
+    REQUIRE((std::is_copy_constructible<gtl::append_log>::value == false));
+
+    REQUIRE((std::is_trivially_copyable<gtl::append_log::future>::value == true));
+}
+
+TEST(append_log, constructor, parameterised) {
+    gtl::file file;
+    gtl::append_log log(file, 1024);
+    REQUIRE(log.capacity() == 1024);
+    REQUIRE(log.durable() == 0);
+    REQUIRE(!log.has_error());
+}
+
+TEST(append_log, function, append) {
+    const std::string temp_filename = std::to_string(std::hash<std::string>{}(std::string(__FUNCTION__)));
+    PRINT("Temp filename for '%s' is: %s\n", __FUNCTION__, temp_filename.c_str());
+    IGNORED(std::remove(temp_filename.c_str()));
+
+    {
+        gtl::file file(temp_filename.c_str(), gtl::file::access_type::write_only, gtl::file::creation_type::create_or_open, gtl::file::cursor_type::end_of_truncated);
+        REQUIRE(file.is_open());
+        gtl::append_log log(file);
+
+        gtl::append_log::future first = log.append("first\n");
+        gtl::append_log::future second = log.append("second\n");
+        REQUIRE(first.is_valid());
+        REQUIRE(second.is_valid());
+        REQUIRE(second.wait());
+        REQUIRE(first.is_ready());
+        REQUIRE(first.wait());
+        REQUIRE(log.durable() == 13);
+
+        REQUIRE(read_file(temp_filename) == "first\nsecond\n");
+
+        gtl::append_log::future empty = log.append("");
+        REQUIRE(empty.is_valid());
+        REQUIRE(empty.is_ready());
+        REQUIRE(empty.wait());
+    }
+
+    IGNORED(std::remove(temp_filename.c_str()));
+}
+
+TEST(append_log, function, oversized) {
+    const std::string temp_filename = std::to_string(std::hash<std::string>{}(std::string(__FUNCTION__)));
+    PRINT("Temp filename for '%s' is: %s\n", __FUNCTION__, temp_filename.c_str());
+    IGNORED(std::remove(temp_filename.c_str()));
+
+    {
+        gtl::file file(temp_filename.c_str(), gtl::file::access_type::write_only, gtl::file::creation_type::create_or_open, gtl::file::cursor_type::end_of_truncated);
+        gtl::append_log log(file, 16);
+
+        gtl::append_log::future rejected = log.append(std::string(17, 'x'));
+        REQUIRE(!rejected.is_valid());
+        REQUIRE(rejected.is_ready());
+        REQUIRE(!rejected.wait());
+
+        REQUIRE(log.append(std::string(16, 'x')).wait());
+    }
+
+    REQUIRE(read_file(temp_filename) == std::string(16, 'x'));
+
+    IGNORED(std::remove(temp_filename.c_str()));
+}
+
+TEST(append_log, function, failure) {
+    // Appending to a file opened for reading fails on the first group, after which records are rejected.
+    const std::string temp_filename = std::to_string(std::hash<std::string>{}(std::string(__FUNCTION__)));
+    PRINT("Temp filename for '%s' is: %s\n", __FUNCTION__, temp_filename.c_str());
+    IGNORED(std::remove(temp_filename.c_str()));
+    IGNORED(std::fclose(std::fopen(temp_filename.c_str(), "wb")));
+
+    {
+        gtl::file file(temp_filename.c_str(), gtl::file::access_type::read_only, gtl::file::creation_type::open_only, gtl::file::cursor_type::start_of_file);
+        gtl::append_log log(file);
+
+        gtl::append_log::future record = log.append("record\n");
+        REQUIRE(record.is_valid());
+        REQUIRE(!record.wait());
+        REQUIRE(log.has_error());
+        REQUIRE(!log.flush());
+        REQUIRE(!log.append("record\n").is_valid());
+    }
+
+    IGNORED(std::remove(temp_filename.c_str()));
+}
+
+TEST(append_log, function, flush) {
+    const std::string temp_filename = std::to_string(std::hash<std::string>{}(std::string(__FUNCTION__)));
+    PRINT("Temp filename for '%s' is: %s\n", __FUNCTION__, temp_filename.c_str());
+    IGNORED(std::remove(temp_filename.c_str()));
+
+    {
+        gtl::file file(temp_filename.c_str(), gtl::file::access_type::write_only, gtl::file::creation_type::create_or_open, gtl::file::cursor_type::end_of_truncated);
+        // With a long delay and large group only a flush writes the records promptly.
+        gtl::append_log log(file, 1024, std::chrono::seconds(60), 1024);
+
+        gtl::append_log::future record = log.append("record\n");
+        REQUIRE(log.flush());
+        REQUIRE(record.is_ready());
+        REQUIRE(read_file(temp_filename) == "record\n");
+    }
+
+    IGNORED(std::remove(temp_filename.c_str()));
+}
+
+TEST(append_log, function, destructor) {
+    const std::string temp_filename = std::to_string(std::hash<std::string>{}(std::string(__FUNCTION__)));
+    PRINT("Temp filename for '%s' is: %s\n", __FUNCTION__, temp_filename.c_str());
+    IGNORED(std::remove(temp_filename.c_str()));
+
+    {
+        gtl::file file(temp_filename.c_str(), gtl::file::access_type::write_only, gtl::file::creation_type::create_or_open, gtl::file::cursor_type::end_of_truncated);
+        gtl::append_log log(file, 1024, std::chrono::seconds(60), 1024, gtl::append_log::sync_type::none);
+        REQUIRE(log.append("record\n").is_valid());
+    }
+
+    REQUIRE(read_file(temp_filename) == "record\n");
+
+    IGNORED(std::remove(temp_filename.c_str()));
+}
+
+TEST(append_log, function, concurrent) {
+    const std::string temp_filename = std::to_string(std::hash<std::string>{}(std::string(__FUNCTION__)));
+    PRINT("Temp filename for '%s' is: %s\n", __FUNCTION__, temp_filename.c_str());
+    IGNORED(std::remove(temp_filename.c_str()));
+
+    constexpr static const int thread_count = 8;
+    constexpr static const int record_count = 2000;
+
+    {
+        gtl::file file(temp_filename.c_str(), gtl::file::access_type::write_only, gtl::file::creation_type::create_or_open, gtl::file::cursor_type::end_of_truncated);
+        // A small buffer makes threads wait for space as well as for durability.
+        gtl::append_log log(file, 512, std::chrono::microseconds(100), 256, gtl::append_log::sync_type::none);
+
+        std::atomic<int> failures(0);
+        std::vector<std::thread> threads;
+        for (int thread = 0; thread < thread_count; ++thread) {
+            threads.emplace_back([&log, &failures, thread]() {
+                for (int record = 0; record < record_count; ++record) {
+                    gtl::append_log::future future = log.append("thread " + std::to_string(thread) + " record " + std::to_string(record) + "\n");
+                    if (!future.is_valid() || (((record % 100) == 0) && !future.wait())) {
+                        ++failures;
+                    }
+                }
+            });
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+        REQUIRE(failures == 0);
+        REQUIRE(log.flush());
+        REQUIRE(!log.has_error());
+    }
+
+    std::vector<std::string> lines = split_lines(read_file(temp_filename));
+    REQUIRE(lines.size() == thread_count * record_count);
+
+    // Records of each thread are written whole and in the order they were added.
+    std::vector<int> next(thread_count, 0);
+    for (const std::string& line : lines) {
+        int thread = -1;
+        int record = -1;
+        REQUIRE(std::sscanf(line.c_str(), "thread %d record %d", &thread, &record) == 2);
+        REQUIRE((thread >= 0) && (thread < thread_count));
+        REQUIRE(record == next[static_cast<std::size_t>(thread)]);
+        ++next[static_cast<std::size_t>(thread)];
+    }
+
+    IGNORED(std::remove(temp_filename.c_str()));
+}
+
+TEST(append_log, evaluate, group_commit) {
+    const std::string temp_filename = std::to_string(std::hash<std::string>{}(std::string(__FUNCTION__)));
+    PRINT("Temp filename for '%s' is: %s\n", __FUNCTION__, temp_filename.c_str());
+    IGNORED(std::remove(temp_filename.c_str()));
+
+    constexpr static const int thread_count = 8;
+    constexpr static const int record_count = 100;
+    const std::string record = "audit record with a typical length of sixty four characters..\n";
+
+    gtl::file file(temp_filename.c_str(), gtl::file::access_type::write_only, gtl::file::creation_type::create_or_open, gtl::file::cursor_type::end_of_truncated);
+    REQUIRE(file.is_open());
+
+    PRINT("Write and sync each record: %f\n", testbench::benchmark([&]() {
+        for (int index = 0; index < thread_count * record_count; ++index) {
+            gtl::file::size_type length = record.size();
+            REQUIRE(file.write(record.data(), length));
+            REQUIRE(file.sync_data());
+        }
+    }, 1));
+
+    for (int delay : { 0, 100, 1000 }) {
+        gtl::append_log log(file, 1024 * 1024, std::chrono::microseconds(delay));
+        std::atomic<int> failures(0);
+        PRINT("Group commit from %d threads waiting for each record, %d us delay: %f\n", thread_count, delay, testbench::benchmark([&]() {
+            std::vector<std::thread> threads;
+            for (int thread = 0; thread < thread_count; ++thread) {
+                threads.emplace_back([&]() {
+                    for (int index = 0; index < record_count; ++index) {
+                        if (!log.append(record).wait()) {
+                            ++failures;
+                        }
+                    }
+                });
+            }
+            for (std::thread& thread : threads) {
+                thread.join();
+            }
+        }, 1));
+        REQUIRE(failures == 0);
+    }
+
+    {
+        gtl::append_log log(file);
+        PRINT("Group commit from 1 thread waiting once: %f\n", testbench::benchmark([&]() {
+            gtl::append_log::future last;
+            for (int index = 0; index < thread_count * record_count; ++index) {
+                last = log.append(record);
+            }
+            REQUIRE(last.wait());
+        }, 1));
+    }
+
+    REQUIRE(file.close());
+    IGNORED(std::remove(temp_filename.c_str()));
+}
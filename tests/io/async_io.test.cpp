@@ -0,0 +1,378 @@
+/*
+Copyright (C) 2018-2024 Geoffrey Daniels. https://gpdaniels.com/
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, version 3 of the License only.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <testbench/main.tests.hpp>
+
+#include <testbench/benchmark.tests.hpp>
+#include <testbench/ignored.tests.hpp>
+#include <testbench/require.tests.hpp>
+
+#include <io/files.test.hpp>
+#include <io/async_io>
+
+#if defined(_MSC_VER)
+#pragma warning(push, 0)
+#endif
+
+#include <cstdio>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+
+namespace {
+    void test_read_and_write(bool use_io_uring) {
+        const std::string temp_filename = std::to_string(std::hash<std::string>{}(std::string(__FUNCTION__) + (use_io_uring ? "io_uring" : "thread_pool")));
+        PRINT("Temp filename for '%s' is: %s\n", __FUNCTION__, temp_filename.c_str());
+        IGNORED(std::remove(temp_filename.c_str()));
+
+        gtl::thread_pool pool(2);
+        {
+            gtl::async_io engine(pool, 8, use_io_uring);
+            if (!use_io_uring) {
+                REQUIRE(engine.get_backend() == gtl::async_io::backend_type::thread_pool);
+            }
+
+            gtl::file file(temp_filename.c_str(), gtl::file::access_type::read_and_write, gtl::file::creation_type::create_or_open, gtl::file::cursor_type::start_of_truncated);
+            REQUIRE(file.is_open());
+
+            long long int written[2] = { -2, -2 };
+            REQUIRE(engine.write_at(file, "hello ", 6, 0, [&written](long long int result) {
+                written[0] = result;
+            }));
+            REQUIRE(engine.write_at(file, "world", 5, 6, [&written](long long int result) {
+                written[1] = result;
+            }));
+            REQUIRE(engine.in_flight() == 2);
+            REQUIRE(written[0] == -2, "Expected callbacks to only run in poll or wait.");
+            REQUIRE(engine.wait(2) == 2);
+            REQUIRE(engine.in_flight() == 0);
+            REQUIRE(written[0] == 6);
+            REQUIRE(written[1] == 5);
+
+            char buffer[16] = {};
+            long long int read = -2;
+            REQUIRE(engine.read_at(file, buffer, sizeof(buffer), 0, [&read](long long int result) {
+                read = result;
+            }));
+            engine.wait();
+            REQUIRE(read == 11);
+            REQUIRE(std::string(buffer, 11) == "hello world");
+
+            gtl::file closed;
+            REQUIRE(engine.read_at(closed, buffer, sizeof(buffer), 0, [&read](long long int result) {
+                read = result;
+            }));
+            engine.wait();
+            REQUIRE(read < 0, "Expected reading a closed file to fail.");
+        }
+        pool.join();
+
+        IGNORED(std::remove(temp_filename.c_str()));
+    }
+
+    void test_random_reads(bool use_io_uring) {
+        const std::string temp_filename = std::to_string(std::hash<std::string>{}(std::string(__FUNCTION__) + (use_io_uring ? "io_uring" : "thread_pool")));
+        PRINT("Temp filename for '%s' is: %s\n", __FUNCTION__, temp_filename.c_str());
+        IGNORED(std::remove(temp_filename.c_str()));
+
+        constexpr static const gtl::file::size_type block_size = 512;
+        constexpr static const gtl::file::size_type block_count = 256;
+        const std::string contents = make_contents(block_size * block_count);
+        write_file(temp_filename, contents);
+
+        gtl::thread_pool pool(2);
+        {
+            gtl::async_io engine(pool, 16, use_io_uring);
+            gtl::file file(temp_filename.c_str(), gtl::file::access_type::read_only, gtl::file::creation_type::open_only, gtl::file::cursor_type::start_of_file);
+            REQUIRE(file.is_open());
+
+            std::vector<char> buffers(block_size * block_count);
+            unsigned int matched = 0;
+            for (gtl::file::size_type index = 0; index < block_count; ++index) {
+                const gtl::file::size_type block = (index * 97) % block_count;
+                char* buffer = &buffers[index * block_size];
+                auto callback = [&contents, &matched, buffer, block](long long int result) {
+                    if ((result == static_cast<long long int>(block_size)) && (std::string(buffer, block_size) == contents.substr(block * block_size, block_size))) {
+                        ++matched;
+                    }
+                };
+                // When the queue is full, complete some reads to free slots.
+                while (!engine.read_at(file, buffer, block_size, block * block_size, callback)) {
+                    engine.wait();
+                }
+            }
+            while (engine.in_flight() > 0) {
+                engine.wait();
+            }
+            REQUIRE(matched == block_count, "Expected %u reads to match, not %u.", static_cast<unsigned int>(block_count), matched);
+        }
+        pool.join();
+
+        IGNORED(std::remove(temp_filename.c_str()));
+    }
+}
+
+TEST(async_io, traits, standard) {
+    REQUIRE((std::is_pod<gtl::async_io>::value == false));
+
+    REQUIRE((std::is_trivial<gtl::async_io>::value == false));
+
+    REQUIRE((std::is_trivially_copyable<gtl::async_io>::value == false));
+
+    REQUIRE((std::is_copy_constructible<gtl::async_io>::value == false));
+
+    REQUIRE((std::is_move_constructible<gtl::async_io>::value == false));
+}
+
+TEST(async_io, constructor, backend) {
+    gtl::thread_pool pool(0);
+    {
+        gtl::async_io engine(pool);
+        PRINT("Backend: %s\n", engine.get_backend() == gtl::async_io::backend_type::io_uring ? "io_uring" : "thread_pool");
+        REQUIRE(engine.in_flight() == 0);
+        REQUIRE(engine.submit() == 0);
+        REQUIRE(engine.poll() == 0);
+        REQUIRE(engine.wait() == 0);
+
+        gtl::async_io fallback(pool, 4, false);
+        REQUIRE(fallback.get_backend() == gtl::async_io::backend_type::thread_pool);
+        REQUIRE(fallback.register_buffers(nullptr, 0) == false);
+        REQUIRE(fallback.register_files(nullptr, 0) == false);
+    }
+    pool.join();
+}
+
+TEST(async_io, function, read_and_write) {
+    test_read_and_write(true);
+    test_read_and_write(false);
+}
+
+TEST(async_io, function, random_reads) {
+    test_random_reads(true);
+    test_random_reads(false);
+}
+
+TEST(async_io, function, full_queue) {
+    const std::string temp_filename = std::to_string(std::hash<std::string>{}(std::string(__FUNCTION__)));
+    PRINT("Temp filename for '%s' is: %s\n", __FUNCTION__, temp_filename.c_str());
+    IGNORED(std::remove(temp_filename.c_str()));
+    write_file(temp_filename, "0123456789");
+
+    // A pool without threads relies on wait to perform the operations.
+    gtl::thread_pool pool(0);
+    {
+        gtl::async_io engine(pool, 2, false);
+        gtl::file file(temp_filename.c_str(), gtl::file::access_type::read_only, gtl::file::creation_type::open_only, gtl::file::cursor_type::start_of_file);
+
+        char buffer[3] = {};
+        unsigned int completed = 0;
+        auto callback = [&completed](long long int result) {
+            completed += (result == 1) ? 1 : 0;
+        };
+        REQUIRE(engine.read_at(file, &buffer[0], 1, 0, callback));
+        REQUIRE(engine.read_at(file, &buffer[1], 1, 5, callback));
+        REQUIRE(engine.read_at(file, &buffer[2], 1, 9, callback) == false, "Expected the queue to be full.");
+        REQUIRE(engine.poll() == 0, "Expected nothing to complete without a thread to perform the operations.");
+        REQUIRE(engine.wait() >= 1);
+        REQUIRE(engine.read_at(file, &buffer[2], 1, 9, callback));
+        engine.wait(engine.in_flight());
+        REQUIRE(completed == 3);
+        REQUIRE(std::string(buffer, 3) == "059");
+    }
+    pool.join();
+
+    IGNORED(std::remove(temp_filename.c_str()));
+}
+
+TEST(async_io, function, callback_queues_operation) {
+    const std::string temp_filename = std::to_string(std::hash<std::string>{}(std::string(__FUNCTION__)));
+    PRINT("Temp filename for '%s' is: %s\n", __FUNCTION__, temp_filename.c_str());
+    IGNORED(std::remove(temp_filename.c_str()));
+    write_file(temp_filename, "0123456789");
+
+    gtl::thread_pool pool(1);
+    {
+        gtl::async_io engine(pool, 1);
+        gtl::file file(temp_filename.c_str(), gtl::file::access_type::read_only, gtl::file::creation_type::open_only, gtl::file::cursor_type::start_of_file);
+
+        // Each callback queues the next read into the slot it has just freed.
+        std::string result;
+        char character = 0;
+        std::function<void(long long int)> callback = [&](long long int length) {
+            if (length == 1) {
+                result.push_back(character);
+                if (result.size() < 10) {
+                    REQUIRE(engine.read_at(file, &character, 1, result.size(), callback));
+                }
+            }
+        };
+        REQUIRE(engine.read_at(file, &character, 1, 0, callback));
+        while (engine.in_flight() > 0) {
+            engine.wait();
+        }
+        REQUIRE(result == "0123456789");
+    }
+    pool.join();
+
+    IGNORED(std::remove(temp_filename.c_str()));
+}
+
+TEST(async_io, function, registered) {
+    const std::string temp_filename = std::to_string(std::hash<std::string>{}(std::string(__FUNCTION__)));
+    PRINT("Temp filename for '%s' is: %s\n", __FUNCTION__, temp_filename.c_str());
+    IGNORED(std::remove(temp_filename.c_str()));
+    const std::string contents = make_contents(4096 * 4);
+    write_file(temp_filename, contents);
+
+    gtl::thread_pool pool(0);
+    {
+        gtl::async_io engine(pool, 8);
+        if (engine.get_backend() != gtl::async_io::backend_type::io_uring) {
+            PRINT("Skipping registered buffers and files as io_uring is not available.\n");
+        }
+        else {
+            gtl::file file(temp_filename.c_str(), gtl::file::access_type::read_and_write, gtl::file::creation_type::open_only, gtl::file::cursor_type::start_of_file);
+            const gtl::file* files[] = { &file };
+            REQUIRE(engine.register_files(files, 1));
+
+            std::vector<char> memory(4096 * 4);
+            const gtl::file::buffer_type buffers[] = { { memory.data(), memory.size() } };
+            REQUIRE(engine.register_buffers(buffers, 1));
+
+            unsigned int completed = 0;
+            for (gtl::file::size_type index = 0; index < 4; ++index) {
+                REQUIRE(engine.read_at(file, &memory[index * 4096], 4096, index * 4096, [&completed](long long int result) {
+                    completed += (result == 4096) ? 1 : 0;
+                }));
+            }
+            engine.wait(4);
+            REQUIRE(completed == 4);
+            REQUIRE(std::string(memory.begin(), memory.end()) == contents);
+
+            // Writes from a registered buffer to a registered file.
+            memory[0] = '#';
+            REQUIRE(engine.write_at(file, memory.data(), 1, 0, [&completed](long long int result) {
+                completed += (result == 1) ? 1 : 0;
+            }));
+            engine.wait();
+            REQUIRE(completed == 5);
+            char first = 0;
+            REQUIRE(engine.read_at(file, &first, 1, 0) == 1);
+            REQUIRE(first == '#');
+
+            REQUIRE(engine.register_buffers(nullptr, 0));
+            REQUIRE(engine.register_files(nullptr, 0));
+        }
+    }
+    pool.join();
+
+    IGNORED(std::remove(temp_filename.c_str()));
+}
+
+TEST(async_io, function, coroutines) {
+    const std::string temp_filename = std::to_string(std::hash<std::string>{}(std::string(__FUNCTION__)));
+    PRINT("Temp filename for '%s' is: %s\n", __FUNCTION__, temp_filename.c_str());
+    IGNORED(std::remove(temp_filename.c_str()));
+    const std::string contents = make_contents(64 * 4);
+    write_file(temp_filename, contents);
+
+    gtl::thread_pool pool(1);
+    {
+        gtl::async_io engine(pool, 4);
+        gtl::file file(temp_filename.c_str(), gtl::file::access_type::read_only, gtl::file::creation_type::open_only, gtl::file::cursor_type::start_of_file);
+
+        // Each coroutine reads its own part of the file, yielding while its reads are in flight.
+        std::string parts[4];
+        auto reader = [&engine, &file, &parts](unsigned int index) {
+            char buffer[16];
+            for (gtl::file::size_type offset = 0; offset < 64; offset += sizeof(buffer)) {
+                const long long int length = engine.read_at(file, buffer, sizeof(buffer), index * 64 + offset);
+                if (length > 0) {
+                    parts[index].append(buffer, static_cast<gtl::file::size_type>(length));
+                }
+            }
+        };
+        gtl::coroutine coroutines[4] = {
+            gtl::coroutine(reader, 0u),
+            gtl::coroutine(reader, 1u),
+            gtl::coroutine(reader, 2u),
+            gtl::coroutine(reader, 3u)
+        };
+        bool running = true;
+        while (running) {
+            running = false;
+            for (gtl::coroutine& coroutine : coroutines) {
+                if (coroutine.joinable()) {
+                    coroutine.join();
+                    running = true;
+                }
+            }
+        }
+        for (unsigned int index = 0; index < 4; ++index) {
+            REQUIRE(parts[index] == contents.substr(index * 64, 64), "Expected part %u to match.", index);
+        }
+
+        // Outside of a coroutine the call blocks until the read completes.
+        char buffer[4] = {};
+        REQUIRE(engine.read_at(file, buffer, 4, 0) == 4);
+        REQUIRE(std::string(buffer, 4) == contents.substr(0, 4));
+    }
+    pool.join();
+
+    IGNORED(std::remove(temp_filename.c_str()));
+}
+
+TEST(async_io, evaluate, random_reads) {
+    const std::string temp_filename = std::to_string(std::hash<std::string>{}(std::string(__FUNCTION__)));
+    PRINT("Temp filename for '%s' is: %s\n", __FUNCTION__, temp_filename.c_str());
+    IGNORED(std::remove(temp_filename.c_str()));
+
+    constexpr static const gtl::file::size_type block_size = 4096;
+    constexpr static const gtl::file::size_type block_count = 1024;
+    write_file(temp_filename, make_contents(block_size * block_count));
+
+    gtl::file file(temp_filename.c_str(), gtl::file::access_type::read_only, gtl::file::creation_type::open_only, gtl::file::cursor_type::start_of_file);
+    std::vector<char> buffers(block_size * 64);
+
+    PRINT("Synchronous read_at:  %f\n", testbench::benchmark([&]() {
+        for (gtl::file::size_type index = 0; index < block_count; ++index) {
+            gtl::file::size_type length = block_size;
+            IGNORED(file.read_at(&buffers[(index % 64) * block_size], length, ((index * 389) % block_count) * block_size));
+        }
+    }, 10));
+
+    gtl::thread_pool pool(3);
+    {
+        gtl::async_io engine(pool, 64);
+        PRINT("Asynchronous read_at: %f\n", testbench::benchmark([&]() {
+            for (gtl::file::size_type index = 0; index < block_count; ++index) {
+                while (!engine.read_at(file, &buffers[(index % 64) * block_size], block_size, ((index * 389) % block_count) * block_size, nullptr)) {
+                    engine.wait();
+                }
+            }
+            while (engine.in_flight() > 0) {
+                engine.wait(engine.in_flight());
+            }
+        }, 10));
+    }
+    pool.join();
+
+    IGNORED(std::remove(temp_filename.c_str()));
+}
@@ -0,0 +1,182 @@
+/*
+Copyright (C) 2018-2024 Geoffrey Daniels. https://gpdaniels.com/
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, version 3 of the License only.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <testbench/main.tests.hpp>
+
+#include <testbench/benchmark.tests.hpp>
+#include <testbench/ignored.tests.hpp>
+#include <testbench/optimise.tests.hpp>
+#include <testbench/require.tests.hpp>
+
+#include <io/files.test.hpp>
+#include <io/buffered_reader>
+
+#if defined(_MSC_VER)
+#pragma warning(push, 0)
+#endif
+
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+
+TEST(buffered_reader, traits, standard) {
+    REQUIRE((std::is_pod<gtl::buffered_reader>::value == false));
+
+    REQUIRE((std::is_trivial<gtl::buffered_reader>::value == false));
+
+    REQUIRE((std::is_trivially_copyable<gtl::buffered_reader>::value == false));
+
+    REQUIRE((std::is_copy_constructible<gtl::buffered_reader>::value == false));
+}
+
+TEST(buffered_reader, function, closed) {
+    gtl::file file;
+    gtl::buffered_reader reader(file);
+    std::string_view line;
+    REQUIRE(reader.read_line(line) == false);
+    REQUIRE(reader.has_error());
+}
+
+TEST(buffered_reader, function, read_line) {
+    const std::string temp_filename = std::to_string(std::hash<std::string>{}(std::string(__FUNCTION__)));
+    PRINT("Temp filename for '%s' is: %s\n", __FUNCTION__, temp_filename.c_str());
+    IGNORED(std::remove(temp_filename.c_str()));
+    write_file(temp_filename, "first\n\nthird line is longer than the buffer\nlast");
+
+    gtl::file file(temp_filename.c_str(), gtl::file::access_type::read_only, gtl::file::creation_type::open_only, gtl::file::cursor_type::start_of_file);
+    gtl::buffered_reader reader(file, 8);
+    std::string_view line;
+    REQUIRE(reader.read_line(line));
+    REQUIRE(line == "first");
+    REQUIRE(reader.read_line(line));
+    REQUIRE(line.empty());
+    REQUIRE(reader.read_line(line));
+    REQUIRE(line == "third line is longer than the buffer");
+    REQUIRE(reader.capacity() > 8, "Expected the buffer to grow to hold the line.");
+    REQUIRE(reader.read_line(line));
+    REQUIRE(line == "last", "Expected the final line without a line feed to be read.");
+    REQUIRE(reader.read_line(line) == false);
+    REQUIRE(reader.is_eof());
+    REQUIRE(reader.has_error() == false);
+
+    IGNORED(std::remove(temp_filename.c_str()));
+}
+
+TEST(buffered_reader, function, records) {
+    const std::string temp_filename = std::to_string(std::hash<std::string>{}(std::string(__FUNCTION__)));
+    PRINT("Temp filename for '%s' is: %s\n", __FUNCTION__, temp_filename.c_str());
+    IGNORED(std::remove(temp_filename.c_str()));
+
+    std::string contents;
+    std::vector<std::string> expected;
+    for (int index = 0; index < 1000; ++index) {
+        expected.push_back(std::to_string(index * 7919));
+        contents += expected.back() + ',';
+    }
+    write_file(temp_filename, contents);
+
+    gtl::file file(temp_filename.c_str(), gtl::file::access_type::read_only, gtl::file::creation_type::open_only, gtl::file::cursor_type::start_of_file);
+    gtl::buffered_reader reader(file, 64);
+    std::vector<std::string> records;
+    for (std::string_view record : reader.records(',')) {
+        records.emplace_back(record);
+    }
+    REQUIRE(records == expected);
+    REQUIRE(reader.capacity() == 64, "Expected the buffer not to grow for short records.");
+
+    IGNORED(std::remove(temp_filename.c_str()));
+}
+
+TEST(buffered_reader, function, peek_skip_read) {
+    const std::string temp_filename = std::to_string(std::hash<std::string>{}(std::string(__FUNCTION__)));
+    PRINT("Temp filename for '%s' is: %s\n", __FUNCTION__, temp_filename.c_str());
+    IGNORED(std::remove(temp_filename.c_str()));
+    write_file(temp_filename, "HEADER0123456789abcdefghijklmnopqrstuvwxyz");
+
+    gtl::file file(temp_filename.c_str(), gtl::file::access_type::read_only, gtl::file::creation_type::open_only, gtl::file::cursor_type::start_of_file);
+    gtl::buffered_reader reader(file, 4);
+    std::string_view view;
+    REQUIRE(reader.peek(view, 6));
+    REQUIRE(view == "HEADER");
+    REQUIRE(reader.peek(view, 2));
+    REQUIRE(view == "HE", "Expected peeking not to consume characters.");
+
+    gtl::file::size_type length = 6;
+    REQUIRE(reader.skip(length));
+    REQUIRE(length == 6);
+
+    char digits[10] = {};
+    length = sizeof(digits);
+    REQUIRE(reader.read(digits, length));
+    REQUIRE(length == 10);
+    REQUIRE(std::string(digits, 10) == "0123456789");
+
+    char letters[64] = {};
+    length = sizeof(letters);
+    REQUIRE(reader.read(letters, length));
+    REQUIRE(length == 26);
+    REQUIRE(std::string(letters, 26) == "abcdefghijklmnopqrstuvwxyz");
+
+    REQUIRE(reader.peek(view, 1));
+    REQUIRE(view.empty());
+    length = 10;
+    REQUIRE(reader.skip(length));
+    REQUIRE(length == 0);
+    REQUIRE(reader.is_eof());
+
+    IGNORED(std::remove(temp_filename.c_str()));
+}
+
+TEST(buffered_reader, evaluate, read_line) {
+    const std::string temp_filename = std::to_string(std::hash<std::string>{}(std::string(__FUNCTION__)));
+    PRINT("Temp filename for '%s' is: %s\n", __FUNCTION__, temp_filename.c_str());
+    IGNORED(std::remove(temp_filename.c_str()));
+
+    std::string contents;
+    for (int index = 0; index < 100000; ++index) {
+        contents += "line " + std::to_string(index) + '\n';
+    }
+    write_file(temp_filename, contents);
+
+    PRINT("gtl::file::read per character:   %f\n", testbench::benchmark([&]() {
+        gtl::file file(temp_filename.c_str(), gtl::file::access_type::read_only, gtl::file::creation_type::open_only, gtl::file::cursor_type::start_of_file);
+        unsigned int lines = 0;
+        char character = 0;
+        gtl::file::size_type length = 1;
+        while (file.read(&character, length) && (length == 1)) {
+            lines += (character == '\n') ? 1 : 0;
+        }
+        testbench::do_not_optimise_away(lines);
+    }, 1));
+
+    PRINT("gtl::buffered_reader::read_line: %f\n", testbench::benchmark([&]() {
+        gtl::file file(temp_filename.c_str(), gtl::file::access_type::read_only, gtl::file::creation_type::open_only, gtl::file::cursor_type::start_of_file);
+        gtl::buffered_reader reader(file);
+        unsigned int lines = 0;
+        for (std::string_view line : reader.lines()) {
+            lines += line.empty() ? 0 : 1;
+        }
+        testbench::do_not_optimise_away(lines);
+    }, 1));
+
+    IGNORED(std::remove(temp_filename.c_str()));
+}
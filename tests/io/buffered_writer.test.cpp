@@ -0,0 +1,136 @@
+/*
+Copyright (C) 2018-2024 Geoffrey Daniels. https://gpdaniels.com/
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, version 3 of the License only.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <testbench/main.tests.hpp>
+
+#include <testbench/benchmark.tests.hpp>
+#include <testbench/ignored.tests.hpp>
+#include <testbench/require.tests.hpp>
+
+#include <io/files.test.hpp>
+#include <io/buffered_writer>
+
+#if defined(_MSC_VER)
+#pragma warning(push, 0)
+#endif
+
+#include <cstdio>
+#include <string>
+#include <type_traits>
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+
+TEST(buffered_writer, traits, standard) {
+    REQUIRE((std::is_pod<gtl::buffered_writer>::value == false));
+
+    REQUIRE((std::is_trivial<gtl::buffered_writer>::value == false));
+
+    REQUIRE((std::is_trivially_copyable<gtl::buffered_writer>::value == false));
+
+    REQUIRE((std::is_copy_constructible<gtl::buffered_writer>::value == false));
+}
+
+TEST(buffered_writer, function, closed) {
+    gtl::file file;
+    gtl::buffered_writer writer(file);
+    REQUIRE(writer.write("hello"));
+    REQUIRE(writer.flush() == false);
+    REQUIRE(writer.has_error());
+}
+
+TEST(buffered_writer, function, coalesce) {
+    const std::string temp_filename = std::to_string(std::hash<std::string>{}(std::string(__FUNCTION__)));
+    PRINT("Temp filename for '%s' is: %s\n", __FUNCTION__, temp_filename.c_str());
+    IGNORED(std::remove(temp_filename.c_str()));
+
+    {
+        gtl::file file(temp_filename.c_str(), gtl::file::access_type::write_only, gtl::file::creation_type::create_or_open, gtl::file::cursor_type::start_of_truncated);
+        gtl::buffered_writer writer(file, 16);
+        REQUIRE(writer.write("hello"));
+        REQUIRE(writer.put(' '));
+        REQUIRE(writer.write("world"));
+        REQUIRE(writer.buffered() == 11);
+        REQUIRE(read_file(temp_filename).empty(), "Expected small writes to be held in the buffer.");
+
+        REQUIRE(writer.write(", and more"));
+        REQUIRE(read_file(temp_filename) == "hello world", "Expected a full buffer to be written.");
+        REQUIRE(writer.buffered() == 10);
+
+        REQUIRE(writer.write("; a write larger than the buffer bypasses it"));
+        REQUIRE(writer.buffered() == 0);
+        REQUIRE(read_file(temp_filename) == "hello world, and more; a write larger than the buffer bypasses it");
+
+        REQUIRE(writer.write("!"));
+    }
+    REQUIRE(read_file(temp_filename) == "hello world, and more; a write larger than the buffer bypasses it!", "Expected destruction to flush.");
+
+    IGNORED(std::remove(temp_filename.c_str()));
+}
+
+TEST(buffered_writer, function, flush_policy) {
+    const std::string temp_filename = std::to_string(std::hash<std::string>{}(std::string(__FUNCTION__)));
+    PRINT("Temp filename for '%s' is: %s\n", __FUNCTION__, temp_filename.c_str());
+    IGNORED(std::remove(temp_filename.c_str()));
+
+    gtl::file file(temp_filename.c_str(), gtl::file::access_type::write_only, gtl::file::creation_type::create_or_open, gtl::file::cursor_type::start_of_truncated);
+    gtl::buffered_writer writer(file, 1024, gtl::buffered_writer::flush_type::each_line);
+    REQUIRE(writer.get_flush_policy() == gtl::buffered_writer::flush_type::each_line);
+    REQUIRE(writer.write("partial"));
+    REQUIRE(read_file(temp_filename).empty());
+    REQUIRE(writer.write(" line\n"));
+    REQUIRE(read_file(temp_filename) == "partial line\n");
+
+    writer.set_flush_policy(gtl::buffered_writer::flush_type::each_write);
+    REQUIRE(writer.put('x'));
+    REQUIRE(read_file(temp_filename) == "partial line\nx");
+
+    writer.set_flush_policy(gtl::buffered_writer::flush_type::when_full);
+    REQUIRE(writer.write("y\n"));
+    REQUIRE(read_file(temp_filename) == "partial line\nx");
+    REQUIRE(writer.flush());
+    REQUIRE(read_file(temp_filename) == "partial line\nxy\n");
+    REQUIRE(writer.has_error() == false);
+
+    IGNORED(std::remove(temp_filename.c_str()));
+}
+
+TEST(buffered_writer, evaluate, small_writes) {
+    const std::string temp_filename = std::to_string(std::hash<std::string>{}(std::string(__FUNCTION__)));
+    PRINT("Temp filename for '%s' is: %s\n", __FUNCTION__, temp_filename.c_str());
+    IGNORED(std::remove(temp_filename.c_str()));
+
+    PRINT("gtl::file::write:            %f\n", testbench::benchmark([&]() {
+        gtl::file file(temp_filename.c_str(), gtl::file::access_type::write_only, gtl::file::creation_type::create_or_open, gtl::file::cursor_type::start_of_truncated);
+        for (int index = 0; index < 100000; ++index) {
+            gtl::file::size_type length = 4;
+            IGNORED(file.write("1.5,", length));
+        }
+    }, 1));
+
+    PRINT("gtl::buffered_writer::write: %f\n", testbench::benchmark([&]() {
+        gtl::file file(temp_filename.c_str(), gtl::file::access_type::write_only, gtl::file::creation_type::create_or_open, gtl::file::cursor_type::start_of_truncated);
+        gtl::buffered_writer writer(file);
+        for (int index = 0; index < 100000; ++index) {
+            IGNORED(writer.write("1.5,", 4));
+        }
+    }, 1));
+
+    REQUIRE(read_file(temp_filename).size() == 400000);
+
+    IGNORED(std::remove(temp_filename.c_str()));
+}
@@ -0,0 +1,290 @@
+/*
+Copyright (C) 2018-2024 Geoffrey Daniels. https://gpdaniels.com/
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, version 3 of the License only.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <testbench/main.tests.hpp>
+
+#include <testbench/benchmark.tests.hpp>
+#include <testbench/require.tests.hpp>
+
+#include <io/event_loop>
+#include <io/sockets.test.hpp>
+
+#if defined(_MSC_VER)
+#pragma warning(push, 0)
+#endif
+
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+
+namespace {
+    void send(const gtl::socket& socket, const char* message, unsigned long long int length) {
+        REQUIRE(socket.write(reinterpret_cast<const unsigned char*>(message), length));
+    }
+}
+
+TEST(event_loop, traits, standard) {
+    REQUIRE((std::is_pod<gtl::event_loop>::value == false));
+
+    REQUIRE((std::is_trivial<gtl::event_loop>::value == false));
+
+    REQUIRE((std::is_trivially_copyable<gtl::event_loop>::value == false));
+
+    REQUIRE((std::is_copy_constructible<gtl::event_loop>::value == false));
+}
+
+TEST(event_loop, constructor, empty) {
+    gtl::event_loop loop;
+    REQUIRE(loop.is_open());
+    REQUIRE(loop.size() == 0);
+    REQUIRE(loop.timer_count() == 0);
+    REQUIRE(loop.run_once(std::chrono::milliseconds(0)) == 0);
+    REQUIRE(loop.run());
+}
+
+TEST(event_loop, function, add_and_remove) {
+    gtl::event_loop loop;
+    loopback_server host;
+    gtl::socket closed;
+
+    REQUIRE(!loop.add(closed, gtl::event_loop::event_readable, [](unsigned int) {}));
+    REQUIRE(loop.add(host.listener, gtl::event_loop::event_readable, [](unsigned int) {}));
+    REQUIRE(!loop.add(host.listener, gtl::event_loop::event_readable, [](unsigned int) {}));
+    REQUIRE(loop.contains(host.listener));
+    REQUIRE(loop.size() == 1);
+    REQUIRE(loop.modify(host.listener, gtl::event_loop::event_readable, gtl::event_loop::trigger_type::edge));
+    REQUIRE(!loop.modify(closed, gtl::event_loop::event_readable));
+    REQUIRE(loop.remove(host.listener));
+    REQUIRE(!loop.remove(host.listener));
+    REQUIRE(!loop.contains(host.listener));
+    REQUIRE(loop.size() == 0);
+}
+
+TEST(event_loop, function, readable) {
+    gtl::event_loop loop;
+    loopback_server host;
+    gtl::socket local;
+    gtl::socket remote;
+    host.connect(local, remote);
+
+    unsigned int calls = 0;
+    unsigned int reported = 0;
+    REQUIRE(loop.add(remote, gtl::event_loop::event_readable, [&](unsigned int events) {
+        ++calls;
+        reported = events;
+    }));
+
+    REQUIRE(loop.run_once(std::chrono::milliseconds(0)) == 0);
+    REQUIRE(calls == 0);
+
+    send(local, "message", 7);
+    REQUIRE(loop.run_once(std::chrono::milliseconds(1000)) == 1);
+    REQUIRE(calls == 1);
+    REQUIRE(reported == gtl::event_loop::event_readable);
+
+    // Level triggered, so the unread message is reported again.
+    REQUIRE(loop.run_once(std::chrono::milliseconds(0)) == 1);
+    REQUIRE(calls == 2);
+
+    // Closing the other end is reported.
+    local.close();
+    REQUIRE(loop.run_once(std::chrono::milliseconds(1000)) == 1);
+    REQUIRE((reported & gtl::event_loop::event_closed) != 0);
+
+    REQUIRE(loop.remove(remote));
+}
+
+TEST(event_loop, function, writable) {
+    gtl::event_loop loop;
+    loopback_server host;
+    gtl::socket local;
+    gtl::socket remote;
+    host.connect(local, remote);
+
+    unsigned int reported = 0;
+    REQUIRE(loop.add(local, gtl::event_loop::event_readable | gtl::event_loop::event_writable, [&](unsigned int events) {
+        reported = events;
+    }));
+    REQUIRE(loop.run_once(std::chrono::milliseconds(1000)) == 1);
+    REQUIRE(reported == gtl::event_loop::event_writable);
+
+    REQUIRE(loop.modify(local, gtl::event_loop::event_readable));
+    REQUIRE(loop.run_once(std::chrono::milliseconds(0)) == 0);
+
+    REQUIRE(loop.remove(local));
+}
+
+TEST(event_loop, function, edge) {
+    gtl::event_loop loop;
+    loopback_server host;
+    gtl::socket local;
+    gtl::socket remote;
+    host.connect(local, remote);
+    REQUIRE(remote.set_blocking(false));
+
+    unsigned int calls = 0;
+    REQUIRE(loop.add(remote, gtl::event_loop::event_readable, [&](unsigned int) {
+        ++calls;
+    }, gtl::event_loop::trigger_type::edge));
+
+    send(local, "first", 5);
+    REQUIRE(loop.run_once(std::chrono::milliseconds(1000)) == 1);
+    REQUIRE(calls == 1);
+
+#if defined(linux) || defined(__linux) || defined(__linux__)
+    // Edge triggered, so the unread message is not reported again until more arrives.
+    REQUIRE(loop.run_once(std::chrono::milliseconds(0)) == 0);
+    REQUIRE(calls == 1);
+#endif
+
+    send(local, "second", 6);
+    REQUIRE(loop.run_once(std::chrono::milliseconds(1000)) == 1);
+    REQUIRE(calls == 2);
+
+    REQUIRE(loop.remove(remote));
+}
+
+TEST(event_loop, function, remove_in_callback) {
+    gtl::event_loop loop;
+    loopback_server host;
+    gtl::socket locals[2];
+    gtl::socket remotes[2];
+    host.connect(locals[0], remotes[0]);
+    host.connect(locals[1], remotes[1]);
+
+    // Whichever is called first removes both, so the other is not called even if its event is in the same batch.
+    unsigned int calls = 0;
+    for (gtl::socket& remote : remotes) {
+        REQUIRE(loop.add(remote, gtl::event_loop::event_readable, [&](unsigned int) {
+            ++calls;
+            REQUIRE(loop.remove(remotes[0]));
+            REQUIRE(loop.remove(remotes[1]));
+        }));
+    }
+
+    send(locals[0], "a", 1);
+    send(locals[1], "b", 1);
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+    REQUIRE(loop.run_once(std::chrono::milliseconds(1000)) == 1);
+    REQUIRE(calls == 1);
+    REQUIRE(loop.size() == 0);
+}
+
+TEST(event_loop, function, timers) {
+    gtl::event_loop loop;
+
+    std::vector<int> order;
+    // The last timer is well after the nested one, so a loaded machine does not reorder them.
+    loop.add_timer(std::chrono::milliseconds(200), [&]() {
+        order.push_back(3);
+    });
+    loop.add_timer(std::chrono::milliseconds(10), [&]() {
+        order.push_back(1);
+        // Timers may be added from a timer.
+        loop.add_timer(std::chrono::milliseconds(10), [&]() {
+            order.push_back(2);
+        });
+    });
+    const gtl::event_loop::timer_type cancelled = loop.add_timer(std::chrono::milliseconds(20), [&]() {
+        order.push_back(0);
+    });
+    REQUIRE(loop.timer_count() == 3);
+    REQUIRE(loop.cancel_timer(cancelled));
+    REQUIRE(!loop.cancel_timer(cancelled));
+
+    const gtl::event_loop::clock_type::time_point start = gtl::event_loop::clock_type::now();
+    REQUIRE(loop.run());
+    REQUIRE(gtl::event_loop::clock_type::now() - start >= std::chrono::milliseconds(200));
+
+    REQUIRE(order.size() == 3);
+    REQUIRE(order[0] == 1);
+    REQUIRE(order[1] == 2);
+    REQUIRE(order[2] == 3);
+    REQUIRE(loop.timer_count() == 0);
+}
+
+TEST(event_loop, function, stop) {
+    gtl::event_loop loop;
+    loopback_server host;
+
+    // The listener has nothing to accept, so run only returns when stopped.
+    REQUIRE(loop.add(host.listener, gtl::event_loop::event_readable, [](unsigned int) {}));
+    std::thread stopper([&loop]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        loop.stop();
+    });
+    REQUIRE(loop.run());
+    stopper.join();
+
+    // A timer can also stop the loop.
+    loop.add_timer(std::chrono::milliseconds(1), [&loop]() {
+        loop.stop();
+    });
+    REQUIRE(loop.run());
+    REQUIRE(loop.remove(host.listener));
+}
+
+TEST(event_loop, evaluate, connections) {
+    loopback_server host;
+    for (unsigned int count : { 100u, 400u, 4000u }) {
+        std::vector<std::unique_ptr<gtl::socket>> locals;
+        std::vector<std::unique_ptr<gtl::socket>> remotes;
+        for (unsigned int index = 0; index < count; ++index) {
+            locals.emplace_back(new gtl::socket());
+            remotes.emplace_back(new gtl::socket());
+            host.connect(*locals.back(), *remotes.back());
+        }
+
+        gtl::event_loop loop;
+        unsigned int calls = 0;
+        for (const std::unique_ptr<gtl::socket>& remote : remotes) {
+            REQUIRE(loop.add(*remote, gtl::event_loop::event_readable, [&calls](unsigned int) {
+                ++calls;
+            }));
+        }
+
+        // One connection of many has data, as is typical for a server of idle clients.
+        send(*locals[count / 2], "x", 1);
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+        // Select cannot wait on handles past FD_SETSIZE, so checking each socket is only measured while they are below it.
+        if (remotes.back()->get_handle() < FD_SETSIZE) {
+            PRINT("Check each of %u sockets with select: %f\n", count, testbench::benchmark([&]() {
+                unsigned int found = 0;
+                for (const std::unique_ptr<gtl::socket>& remote : remotes) {
+                    found += remote->is_data_available() ? 1 : 0;
+                }
+                REQUIRE(found == 1);
+            }, 100));
+        }
+
+        PRINT("Wait on %u sockets with the event loop: %f\n", count, testbench::benchmark([&]() {
+            REQUIRE(loop.run_once(std::chrono::milliseconds(0)) == 1);
+        }, 100));
+        REQUIRE(calls >= 100);
+
+        for (const std::unique_ptr<gtl::socket>& remote : remotes) {
+            REQUIRE(loop.remove(*remote));
+        }
+    }
+}
@@ -29,8 +29,10 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 #include <cstdio>
 #include <string>
+#include <thread>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #if defined(_MSC_VER)
 #pragma warning(pop)
@@ -516,3 +518,228 @@ TEST(file, function, write) {
 
     IGNORED(std::remove(temp_filename.c_str()));
 }
+
+TEST(file, function, read_at_and_write_at) {
+    gtl::file file;
+
+    const std::string temp_filename = std::to_string(std::hash<std::string>{}(std::string(__FUNCTION__)));
+    PRINT("Temp filename for '%s' is: %s\n", __FUNCTION__, temp_filename.c_str());
+    IGNORED(std::remove(temp_filename.c_str()));
+    IGNORED(std::fclose(std::fopen(temp_filename.c_str(), "wb")));
+
+    {
+        char buffer[1] = {};
+        gtl::file::size_type length = 1;
+        REQUIRE(file.read_at(buffer, length, 0) == false);
+        REQUIRE(length == 0);
+    }
+
+    REQUIRE(file.open(temp_filename.c_str(), gtl::file::access_type::read_and_write));
+
+    {
+        gtl::file::size_type length = 5;
+        REQUIRE(file.write_at("world", length, 6));
+        REQUIRE(length == 5);
+    }
+    {
+        gtl::file::size_type length = 6;
+        REQUIRE(file.write_at("hello ", length, 0));
+        REQUIRE(length == 6);
+    }
+
+    // Positional operations leave the cursor where it was.
+    gtl::file::size_type position = 1;
+    REQUIRE(file.get_cursor_position(position));
+    REQUIRE(position == 0);
+
+    {
+        char buffer[5] = {};
+        gtl::file::size_type length = 5;
+        REQUIRE(file.read_at(buffer, length, 6));
+        REQUIRE(length == 5);
+        REQUIRE(std::string(buffer, length) == "world");
+    }
+    {
+        char buffer[5] = {};
+        gtl::file::size_type length = 5;
+        REQUIRE(file.read_at(buffer, length, 9));
+        REQUIRE(length == 2);
+        REQUIRE(std::string(buffer, length) == "ld");
+    }
+
+    IGNORED(std::remove(temp_filename.c_str()));
+}
+
+TEST(file, function, vectored) {
+    gtl::file file;
+
+    const std::string temp_filename = std::to_string(std::hash<std::string>{}(std::string(__FUNCTION__)));
+    PRINT("Temp filename for '%s' is: %s\n", __FUNCTION__, temp_filename.c_str());
+    IGNORED(std::remove(temp_filename.c_str()));
+    IGNORED(std::fclose(std::fopen(temp_filename.c_str(), "wb")));
+
+    REQUIRE(file.open(temp_filename.c_str(), gtl::file::access_type::read_and_write));
+
+    {
+        const gtl::file::const_buffer_type buffers[3] = { { "header:", 7 }, { "body:", 5 }, { "footer", 6 } };
+        gtl::file::size_type length = 0;
+        REQUIRE(file.writev(buffers, 3, length));
+        REQUIRE(length == 18);
+    }
+    {
+        const gtl::file::const_buffer_type buffers[2] = { { "BODY", 4 }, { ":", 1 } };
+        gtl::file::size_type length = 0;
+        REQUIRE(file.writev_at(buffers, 2, 7, length));
+        REQUIRE(length == 5);
+    }
+
+    REQUIRE(file.set_cursor_position(0));
+
+    {
+        char header[7] = {};
+        char body[5] = {};
+        char footer[6] = {};
+        const gtl::file::buffer_type buffers[3] = { { header, 7 }, { body, 5 }, { footer, 6 } };
+        gtl::file::size_type length = 0;
+        REQUIRE(file.readv(buffers, 3, length));
+        REQUIRE(length == 18);
+        REQUIRE(std::string(header, 7) == "header:");
+        REQUIRE(std::string(body, 5) == "BODY:");
+        REQUIRE(std::string(footer, 6) == "footer");
+    }
+    {
+        char first[2] = {};
+        char second[10] = {};
+        const gtl::file::buffer_type buffers[2] = { { first, 2 }, { second, 10 } };
+        gtl::file::size_type length = 0;
+        REQUIRE(file.readv_at(buffers, 2, 10, length));
+        REQUIRE(length == 8);
+        REQUIRE(std::string(first, 2) == "Y:");
+        REQUIRE(std::string(second, 6) == "footer");
+    }
+
+    IGNORED(std::remove(temp_filename.c_str()));
+}
+
+TEST(file, function, direct) {
+    const std::string temp_filename = std::to_string(std::hash<std::string>{}(std::string(__FUNCTION__)));
+    PRINT("Temp filename for '%s' is: %s\n", __FUNCTION__, temp_filename.c_str());
+    IGNORED(std::remove(temp_filename.c_str()));
+
+    alignas(gtl::file::direct_alignment) static char buffer[gtl::file::direct_alignment * 2];
+    REQUIRE(gtl::file::is_aligned(buffer, sizeof(buffer), gtl::file::direct_alignment));
+    REQUIRE(gtl::file::is_aligned(buffer + 1, sizeof(buffer)) == false);
+    REQUIRE(gtl::file::is_aligned(buffer, 100) == false);
+    REQUIRE(gtl::file::is_aligned(buffer, sizeof(buffer), 100) == false);
+    REQUIRE(gtl::file::is_aligned(buffer + 512, 1024, 512, 512));
+
+    gtl::file file;
+    if (!file.open(temp_filename.c_str(), gtl::file::access_type::read_and_write, gtl::file::creation_type::create_or_open, gtl::file::cursor_type::start_of_truncated, gtl::file::caching_type::direct)) {
+        PRINT("Skipping direct reads and writes as the file system does not support them.\n");
+        IGNORED(std::remove(temp_filename.c_str()));
+        return;
+    }
+    REQUIRE(file.is_direct());
+
+    for (gtl::file::size_type index = 0; index < sizeof(buffer); ++index) {
+        buffer[index] = static_cast<char>('a' + index % 26);
+    }
+    {
+        gtl::file::size_type length = sizeof(buffer);
+        REQUIRE(file.write_at(buffer, length, 0));
+        REQUIRE(length == sizeof(buffer));
+    }
+    {
+        gtl::file::size_type length = 100;
+        REQUIRE(file.write_at(buffer, length, 0) == false, "Expected an unaligned length to be refused.");
+        REQUIRE(length == 0);
+    }
+    {
+        gtl::file::size_type length = gtl::file::direct_alignment;
+        REQUIRE(file.read_at(buffer + 1, length, 0) == false, "Expected an unaligned buffer to be refused.");
+        REQUIRE(length == 0);
+    }
+    {
+        gtl::file::size_type length = gtl::file::direct_alignment;
+        REQUIRE(file.read_at(buffer, length, gtl::file::direct_alignment));
+        REQUIRE(length == gtl::file::direct_alignment);
+        REQUIRE(buffer[0] == static_cast<char>('a' + gtl::file::direct_alignment % 26));
+    }
+    {
+        // Reading past the end of the file returns the characters that remain.
+        gtl::file::size_type length = sizeof(buffer);
+        REQUIRE(file.read_at(buffer, length, gtl::file::direct_alignment));
+        REQUIRE(length == gtl::file::direct_alignment);
+    }
+
+    REQUIRE(file.close());
+    REQUIRE(file.is_direct() == false);
+
+    IGNORED(std::remove(temp_filename.c_str()));
+}
+
+TEST(file, function, sync) {
+    gtl::file file;
+
+    REQUIRE(!file.sync());
+    REQUIRE(!file.sync_data());
+
+    const std::string temp_filename = std::to_string(std::hash<std::string>{}(std::string(__FUNCTION__)));
+    PRINT("Temp filename for '%s' is: %s\n", __FUNCTION__, temp_filename.c_str());
+    IGNORED(std::remove(temp_filename.c_str()));
+
+    REQUIRE(file.open(temp_filename.c_str(), gtl::file::access_type::write_only, gtl::file::creation_type::create_or_open, gtl::file::cursor_type::end_of_truncated));
+
+    char buffer[2] = { 'a', 'b' };
+    gtl::file::size_type length = 2;
+    REQUIRE(file.write(buffer, length));
+    REQUIRE(file.sync_data());
+    REQUIRE(file.write(buffer, length));
+    REQUIRE(file.sync());
+
+    gtl::file::size_type size = 0;
+    REQUIRE(file.get_size(size));
+    REQUIRE(size == 4);
+
+    REQUIRE(file.close());
+    IGNORED(std::remove(temp_filename.c_str()));
+}
+
+TEST(file, evaluate, concurrent_read_at) {
+    const std::string temp_filename = std::to_string(std::hash<std::string>{}(std::string(__FUNCTION__)));
+    PRINT("Temp filename for '%s' is: %s\n", __FUNCTION__, temp_filename.c_str());
+    IGNORED(std::remove(temp_filename.c_str()));
+
+    constexpr static const unsigned int record_count = 4096;
+    {
+        gtl::file file(temp_filename.c_str(), gtl::file::access_type::write_only, gtl::file::creation_type::create_or_open, gtl::file::cursor_type::start_of_truncated);
+        for (unsigned int index = 0; index < record_count; ++index) {
+            gtl::file::size_type length = sizeof(index);
+            REQUIRE(file.write(reinterpret_cast<const char*>(&index), length));
+        }
+    }
+
+    // Several threads share one handle, each reading its own records.
+    gtl::file file(temp_filename.c_str());
+    std::vector<unsigned int> failures(4, 0);
+    std::vector<std::thread> threads;
+    for (unsigned int thread = 0; thread < 4; ++thread) {
+        threads.emplace_back([&file, &failures, thread]() {
+            for (unsigned int index = thread; index < record_count; index += 4) {
+                unsigned int value = 0;
+                gtl::file::size_type length = sizeof(value);
+                if (!file.read_at(reinterpret_cast<char*>(&value), length, index * sizeof(value)) || (length != sizeof(value)) || (value != index)) {
+                    ++failures[thread];
+                }
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    for (unsigned int thread_failures : failures) {
+        REQUIRE(thread_failures == 0);
+    }
+
+    IGNORED(std::remove(temp_filename.c_str()));
+}
@@ -0,0 +1,64 @@
+/*
+Copyright (C) 2018-2024 Geoffrey Daniels. https://gpdaniels.com/
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, version 3 of the License only.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+#ifndef GTL_IO_FILES_TEST_HPP
+#define GTL_IO_FILES_TEST_HPP
+
+#include <testbench/ignored.tests.hpp>
+
+#include <io/file>
+
+#if defined(_MSC_VER)
+#pragma warning(push, 0)
+#endif
+
+#include <string>
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+
+/// @brief Make contents of a given size that vary along the file, so data read from the wrong offset is detected.
+inline std::string make_contents(gtl::file::size_type size) {
+    std::string contents(size, '\0');
+    for (gtl::file::size_type index = 0; index < size; ++index) {
+        contents[index] = static_cast<char>('a' + (index * 7 + index / 251) % 26);
+    }
+    return contents;
+}
+
+/// @brief Replace the contents of a file, creating it if needed.
+inline void write_file(const std::string& filename, const std::string& contents) {
+    gtl::file file(filename.c_str(), gtl::file::access_type::write_only, gtl::file::creation_type::create_or_open, gtl::file::cursor_type::start_of_truncated);
+    gtl::file::size_type length = contents.size();
+    IGNORED(file.write(contents.c_str(), length));
+}
+
+/// @brief Read the whole contents of a file.
+inline std::string read_file(const std::string& filename) {
+    gtl::file file(filename.c_str(), gtl::file::access_type::read_only, gtl::file::creation_type::open_only, gtl::file::cursor_type::start_of_file);
+    std::string contents;
+    char buffer[4096];
+    gtl::file::size_type length = sizeof(buffer);
+    while (file.read(buffer, length) && (length > 0)) {
+        contents.append(buffer, length);
+        length = sizeof(buffer);
+    }
+    return contents;
+}
+
+#endif // GTL_IO_FILES_TEST_HPP
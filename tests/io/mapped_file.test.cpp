@@ -0,0 +1,164 @@
+/*
+Copyright (C) 2018-2024 Geoffrey Daniels. https://gpdaniels.com/
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, version 3 of the License only.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <testbench/main.tests.hpp>
+
+#include <testbench/ignored.tests.hpp>
+#include <testbench/require.tests.hpp>
+
+#include <io/files.test.hpp>
+#include <io/mapped_file>
+
+#include <file/text/json>
+
+#if defined(_MSC_VER)
+#pragma warning(push, 0)
+#endif
+
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+
+TEST(mapped_file, traits, standard) {
+    REQUIRE((std::is_pod<gtl::mapped_file>::value == false));
+
+    REQUIRE((std::is_trivial<gtl::mapped_file>::value == false));
+
+    REQUIRE((std::is_trivially_copyable<gtl::mapped_file>::value == false));
+
+    REQUIRE((std::is_standard_layout<gtl::mapped_file>::value == true));
+}
+
+TEST(mapped_file, constructor, empty) {
+    gtl::mapped_file mapped;
+    REQUIRE(mapped.is_open() == false);
+    REQUIRE(mapped.data() == nullptr);
+    REQUIRE(mapped.size() == 0);
+    REQUIRE(mapped.remap() == false);
+    REQUIRE(mapped.close() == false);
+}
+
+TEST(mapped_file, function, read_only) {
+    const std::string temp_filename = std::to_string(std::hash<std::string>{}(std::string(__FUNCTION__)));
+    PRINT("Temp filename for '%s' is: %s\n", __FUNCTION__, temp_filename.c_str());
+    IGNORED(std::remove(temp_filename.c_str()));
+
+    gtl::mapped_file missing(temp_filename.c_str());
+    REQUIRE(missing.is_open() == false);
+
+    write_file(temp_filename, "hello mapped world");
+
+    gtl::mapped_file mapped(temp_filename.c_str());
+    REQUIRE(mapped.is_open());
+    REQUIRE(mapped.size() == 18);
+    REQUIRE(std::string_view(mapped.data(), mapped.size()) == "hello mapped world");
+    REQUIRE(std::string(mapped.begin(), mapped.end()) == "hello mapped world");
+    REQUIRE(mapped.resize(100) == false);
+
+    REQUIRE(mapped.advise(gtl::mapped_file::advice_type::sequential));
+    REQUIRE(mapped.advise(gtl::mapped_file::advice_type::random));
+    REQUIRE(mapped.advise(gtl::mapped_file::advice_type::will_need, 6, 6));
+    REQUIRE(mapped.advise(gtl::mapped_file::advice_type::normal, 100, 1) == false);
+    // Huge pages are only a hint, file systems may refuse them.
+    IGNORED(mapped.advise(gtl::mapped_file::advice_type::huge_pages));
+
+    REQUIRE(mapped.close());
+    REQUIRE(mapped.data() == nullptr);
+
+    IGNORED(std::remove(temp_filename.c_str()));
+}
+
+TEST(mapped_file, function, read_and_write) {
+    const std::string temp_filename = std::to_string(std::hash<std::string>{}(std::string(__FUNCTION__)));
+    PRINT("Temp filename for '%s' is: %s\n", __FUNCTION__, temp_filename.c_str());
+    IGNORED(std::remove(temp_filename.c_str()));
+
+    {
+        // A new file is created empty, so nothing is mapped until it is resized.
+        gtl::mapped_file mapped(temp_filename.c_str(), gtl::mapped_file::access_type::read_and_write);
+        REQUIRE(mapped.is_open());
+        REQUIRE(mapped.empty());
+        REQUIRE(mapped.flush());
+
+        REQUIRE(mapped.resize(10000));
+        REQUIRE(mapped.size() == 10000);
+        REQUIRE(mapped.data()[9999] == 0);
+        for (int index = 0; index < 10000; ++index) {
+            mapped.data()[index] = static_cast<char>('a' + (index % 26));
+        }
+        REQUIRE(mapped.flush());
+
+        REQUIRE(mapped.resize(26));
+        REQUIRE(mapped.size() == 26);
+    }
+
+    gtl::file file(temp_filename.c_str());
+    char buffer[64] = {};
+    gtl::file::size_type length = sizeof(buffer);
+    REQUIRE(file.read(&buffer[0], length));
+    REQUIRE(std::string(&buffer[0], length) == "abcdefghijklmnopqrstuvwxyz");
+
+    IGNORED(std::remove(temp_filename.c_str()));
+}
+
+TEST(mapped_file, function, remap) {
+    const std::string temp_filename = std::to_string(std::hash<std::string>{}(std::string(__FUNCTION__)));
+    PRINT("Temp filename for '%s' is: %s\n", __FUNCTION__, temp_filename.c_str());
+    IGNORED(std::remove(temp_filename.c_str()));
+
+    write_file(temp_filename, "first");
+
+    gtl::mapped_file mapped(temp_filename.c_str());
+    REQUIRE(mapped.size() == 5);
+
+    // Grow the file through another handle, the mapping only covers the new contents once remapped.
+    {
+        gtl::file file(temp_filename.c_str(), gtl::file::access_type::write_only, gtl::file::creation_type::open_only, gtl::file::cursor_type::end_of_file);
+        std::string contents(100000, 'x');
+        gtl::file::size_type length = contents.size();
+        REQUIRE(file.write(contents.c_str(), length));
+    }
+    REQUIRE(mapped.size() == 5);
+    REQUIRE(mapped.remap());
+    REQUIRE(mapped.size() == 100005);
+    REQUIRE(std::string_view(mapped.data(), 6) == "firstx");
+    REQUIRE(mapped.data()[100004] == 'x');
+    REQUIRE(mapped.remap());
+
+    IGNORED(std::remove(temp_filename.c_str()));
+}
+
+TEST(mapped_file, evaluate, json) {
+    const std::string temp_filename = std::to_string(std::hash<std::string>{}(std::string(__FUNCTION__)));
+    PRINT("Temp filename for '%s' is: %s\n", __FUNCTION__, temp_filename.c_str());
+    IGNORED(std::remove(temp_filename.c_str()));
+
+    write_file(temp_filename, "{ \"name\": \"mapped\", \"values\": [1, 2, 3] }");
+
+    // The mapped contents are parsed in place without being copied into a string.
+    gtl::mapped_file mapped(temp_filename.c_str());
+    REQUIRE(mapped.advise(gtl::mapped_file::advice_type::sequential));
+    gtl::json json;
+    REQUIRE(json.parse(std::string_view(mapped.data(), mapped.size())));
+    REQUIRE(json.document().as<gtl::json::value::object_type>()["name"].as<gtl::json::value::string_type>() == "mapped");
+
+    IGNORED(std::remove(temp_filename.c_str()));
+}
@@ -0,0 +1,157 @@
+/*
+Copyright (C) 2018-2024 Geoffrey Daniels. https://gpdaniels.com/
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, version 3 of the License only.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <testbench/main.tests.hpp>
+
+#include <testbench/benchmark.tests.hpp>
+#include <testbench/ignored.tests.hpp>
+#include <testbench/optimise.tests.hpp>
+#include <testbench/require.tests.hpp>
+
+#include <io/files.test.hpp>
+#include <io/sequential_reader>
+
+#if defined(_MSC_VER)
+#pragma warning(push, 0)
+#endif
+
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+
+namespace {
+    std::string scan(const std::string& filename, gtl::file::caching_type caching_mode, bool use_io_uring, gtl::file::size_type block_size, gtl::file::size_type offset = 0) {
+        gtl::file file;
+        if (!file.open(filename.c_str(), gtl::file::access_type::read_only, gtl::file::creation_type::open_only, gtl::file::cursor_type::start_of_file, caching_mode)) {
+            // Fall back to cached reads on file systems without direct reads.
+            IGNORED(file.open(filename.c_str()));
+        }
+        gtl::thread_pool pool(1);
+        std::string result;
+        {
+            gtl::async_io engine(pool, 4, use_io_uring);
+            gtl::sequential_reader reader(file, engine, block_size, offset);
+            gtl::file::size_type position = offset;
+            std::string_view block;
+            while (reader.next(block)) {
+                REQUIRE(reader.position() == position);
+                position += block.size();
+                result.append(block);
+            }
+            REQUIRE(reader.has_error() == false);
+            REQUIRE(reader.next(block) == false);
+        }
+        pool.join();
+        return result;
+    }
+}
+
+TEST(sequential_reader, traits, standard) {
+    REQUIRE((std::is_pod<gtl::sequential_reader>::value == false));
+
+    REQUIRE((std::is_trivial<gtl::sequential_reader>::value == false));
+
+    REQUIRE((std::is_trivially_copyable<gtl::sequential_reader>::value == false));
+
+    REQUIRE((std::is_copy_constructible<gtl::sequential_reader>::value == false));
+}
+
+TEST(sequential_reader, function, next) {
+    const std::string temp_filename = std::to_string(std::hash<std::string>{}(std::string(__FUNCTION__)));
+    PRINT("Temp filename for '%s' is: %s\n", __FUNCTION__, temp_filename.c_str());
+    IGNORED(std::remove(temp_filename.c_str()));
+
+    // Sizes shorter than, equal to, and between multiples of the block size.
+    for (unsigned long long int size : { 0ull, 100ull, 8192ull, 8192ull * 5 + 123ull, 8192ull * 8 }) {
+        const std::string contents = make_contents(size);
+        write_file(temp_filename, contents);
+        for (bool use_io_uring : { true, false }) {
+            REQUIRE(scan(temp_filename, gtl::file::caching_type::cached, use_io_uring, 8192) == contents, "Expected a cached scan of %llu characters to match.", size);
+            REQUIRE(scan(temp_filename, gtl::file::caching_type::direct, use_io_uring, 8192) == contents, "Expected a direct scan of %llu characters to match.", size);
+        }
+    }
+
+    IGNORED(std::remove(temp_filename.c_str()));
+}
+
+TEST(sequential_reader, function, offset) {
+    const std::string temp_filename = std::to_string(std::hash<std::string>{}(std::string(__FUNCTION__)));
+    PRINT("Temp filename for '%s' is: %s\n", __FUNCTION__, temp_filename.c_str());
+    IGNORED(std::remove(temp_filename.c_str()));
+
+    const std::string contents = make_contents(4096 * 10 + 7);
+    write_file(temp_filename, contents);
+    REQUIRE(scan(temp_filename, gtl::file::caching_type::direct, true, 3000, 4096 * 3) == contents.substr(4096 * 3));
+
+    IGNORED(std::remove(temp_filename.c_str()));
+}
+
+TEST(sequential_reader, evaluate, scan) {
+    const std::string temp_filename = std::to_string(std::hash<std::string>{}(std::string(__FUNCTION__)));
+    PRINT("Temp filename for '%s' is: %s\n", __FUNCTION__, temp_filename.c_str());
+    IGNORED(std::remove(temp_filename.c_str()));
+
+    constexpr static const gtl::file::size_type size = 64 * 1024 * 1024;
+    write_file(temp_filename, make_contents(size));
+
+    auto checksum = [](std::string_view block) {
+        unsigned long long int sum = 0;
+        for (char character : block) {
+            sum = sum * 31 + static_cast<unsigned char>(character);
+        }
+        return sum;
+    };
+
+    PRINT("gtl::file::read:               %f\n", testbench::benchmark([&]() {
+        gtl::file file(temp_filename.c_str());
+        gtl::aligned_buffer buffer(1024 * 1024);
+        unsigned long long int sum = 0;
+        gtl::file::size_type length = buffer.size();
+        while (file.read(buffer.data(), length) && (length > 0)) {
+            sum += checksum(std::string_view(buffer.data(), length));
+            length = buffer.size();
+        }
+        testbench::do_not_optimise_away(sum);
+    }, 1));
+
+    for (gtl::file::caching_type caching_mode : { gtl::file::caching_type::cached, gtl::file::caching_type::direct }) {
+        PRINT("gtl::sequential_reader %s: %f\n", (caching_mode == gtl::file::caching_type::cached) ? "cached" : "direct", testbench::benchmark([&]() {
+            gtl::file file;
+            if (!file.open(temp_filename.c_str(), gtl::file::access_type::read_only, gtl::file::creation_type::open_only, gtl::file::cursor_type::start_of_file, caching_mode)) {
+                IGNORED(file.open(temp_filename.c_str()));
+            }
+            gtl::thread_pool pool(1);
+            {
+                gtl::async_io engine(pool, 4);
+                gtl::sequential_reader reader(file, engine);
+                unsigned long long int sum = 0;
+                std::string_view block;
+                while (reader.next(block)) {
+                    sum += checksum(block);
+                }
+                testbench::do_not_optimise_away(sum);
+            }
+            pool.join();
+        }, 1));
+    }
+
+    IGNORED(std::remove(temp_filename.c_str()));
+}
@@ -16,7 +16,9 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 #include <testbench/main.tests.hpp>
 
+#include <testbench/benchmark.tests.hpp>
 #include <testbench/comparison.tests.hpp>
+#include <testbench/ignored.tests.hpp>
 #include <testbench/optimise.tests.hpp>
 #include <testbench/require.tests.hpp>
 
@@ -27,7 +29,10 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #pragma warning(push, 0)
 #endif
 
+#include <cstdio>
+#include <functional>
 #include <mutex>
+#include <string>
 #include <thread>
 #include <type_traits>
 
@@ -288,3 +293,619 @@ TEST(socket, function, read_write_udp) {
     REQUIRE(received_length2 == sent_length2, "Mismatching lengths of sent (%llu) and receieved (%llu) data.", sent_length2, received_length2);
     REQUIRE(testbench::is_memory_same(sent_message2, received_message2, sent_length2), "Mismatching sent and receieved data. '%s' != '%s'", sent_message2, received_message2);
 }
+
+TEST(socket, function, read_would_block) {
+    gtl::socket server;
+    REQUIRE(server.open(gtl::socket::tcp_server{ gtl::socket::ip_any, gtl::socket::port_any }));
+    gtl::socket::ip address;
+    unsigned short port = 0;
+    REQUIRE(server.get_config(address, port));
+    gtl::socket local;
+    REQUIRE(local.open(gtl::socket::tcp_client{ gtl::socket::ip_any, gtl::socket::port_any, gtl::socket::ip_loopback, port }));
+    gtl::socket remote;
+    REQUIRE(server.accept(remote));
+
+    // Nothing has been sent, so the read would block, even though the socket is blocking.
+    unsigned char buffer[128] = {};
+    unsigned long long int length = sizeof(buffer);
+    bool would_block = false;
+    REQUIRE(remote.read(buffer, length, would_block));
+    REQUIRE(length == 0);
+    REQUIRE(would_block == true);
+
+    const char* message = "Test message";
+    unsigned long long int message_length = testbench::string_length(message);
+    REQUIRE(local.write(reinterpret_cast<const unsigned char*>(message), message_length));
+    do {
+        length = sizeof(buffer);
+        REQUIRE(remote.read(buffer, length, would_block));
+    } while (would_block);
+    REQUIRE(length == message_length);
+    REQUIRE(testbench::is_memory_same(message, buffer, message_length));
+
+    // Once the peer shuts down, a read returns no data without would block.
+    REQUIRE(shutdown(local.get_handle(), SD_BOTH) == 0);
+    do {
+        length = sizeof(buffer);
+        REQUIRE(remote.read(buffer, length, would_block));
+    } while (would_block);
+    REQUIRE(length == 0);
+}
+
+TEST(socket, function, read_exact) {
+    gtl::socket server;
+    REQUIRE(server.open(gtl::socket::tcp_server{ gtl::socket::ip_any, gtl::socket::port_any }));
+    gtl::socket::ip address;
+    unsigned short port = 0;
+    REQUIRE(server.get_config(address, port));
+    gtl::socket local;
+    REQUIRE(local.open(gtl::socket::tcp_client{ gtl::socket::ip_any, gtl::socket::port_any, gtl::socket::ip_loopback, port }));
+    gtl::socket remote;
+    REQUIRE(server.accept(remote));
+
+    // The message arrives in pieces, on both a blocking and a non-blocking socket.
+    for (bool blocking : { true, false }) {
+        REQUIRE(remote.set_blocking(blocking));
+        std::thread writer([&local]() {
+            for (unsigned char piece = 0; piece < 10; ++piece) {
+                unsigned char data[100];
+                for (unsigned char& character : data) {
+                    character = piece;
+                }
+                unsigned long long int length = sizeof(data);
+                local.write(data, length);
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        });
+        unsigned char buffer[1000] = {};
+        unsigned long long int length = sizeof(buffer);
+        const bool success = remote.read_exact(buffer, length);
+        writer.join();
+        REQUIRE(success);
+        REQUIRE(length == sizeof(buffer));
+        for (unsigned long long int index = 0; index < sizeof(buffer); ++index) {
+            REQUIRE(buffer[index] == index / 100);
+        }
+    }
+
+    // A message cut short by the peer closing reports what arrived.
+    unsigned char data[10] = {};
+    unsigned long long int data_length = sizeof(data);
+    REQUIRE(local.write(data, data_length));
+    REQUIRE(shutdown(local.get_handle(), SD_BOTH) == 0);
+    unsigned char buffer[20] = {};
+    unsigned long long int length = sizeof(buffer);
+    REQUIRE(!remote.read_exact(buffer, length));
+    REQUIRE(length == 10);
+}
+
+TEST(socket, function, tuning_options) {
+    gtl::socket closed;
+    REQUIRE(!closed.set_no_delay(true));
+    REQUIRE(!closed.set_receive_buffer_size(65536));
+    int size = 0;
+    REQUIRE(!closed.get_send_buffer_size(size));
+
+    gtl::socket server;
+    REQUIRE(server.open(gtl::socket::tcp_server{ gtl::socket::ip_any, gtl::socket::port_any, false, 16 }));
+    gtl::socket::ip address;
+    unsigned short port = 0;
+    REQUIRE(server.get_config(address, port));
+    gtl::socket local;
+    REQUIRE(local.open(gtl::socket::tcp_client{ gtl::socket::ip_any, gtl::socket::port_any, gtl::socket::ip_loopback, port }));
+    REQUIRE(local.set_no_delay(true));
+    REQUIRE(local.set_no_delay(false));
+#if defined(linux) || defined(__linux) || defined(__linux__)
+    REQUIRE(local.set_quick_ack(true));
+#endif
+
+    // The operating system may round or double the size, but not reduce it.
+    REQUIRE(local.set_receive_buffer_size(65536));
+    REQUIRE(local.get_receive_buffer_size(size));
+    REQUIRE(size >= 65536);
+    REQUIRE(local.set_send_buffer_size(65536));
+    REQUIRE(local.get_send_buffer_size(size));
+    REQUIRE(size >= 65536);
+}
+
+TEST(socket, function, reuse_port) {
+    gtl::socket first;
+    REQUIRE(first.open(gtl::socket::tcp_server{ gtl::socket::ip_any, gtl::socket::port_any, true }));
+    gtl::socket::ip address;
+    unsigned short port = 0;
+    REQUIRE(first.get_config(address, port));
+
+    // Without sharing, the port is in use.
+    gtl::socket exclusive;
+    REQUIRE(!exclusive.open(gtl::socket::tcp_server{ gtl::socket::ip_any, port }));
+
+#if defined(SO_REUSEPORT)
+    gtl::socket second;
+    REQUIRE(second.open(gtl::socket::tcp_server{ gtl::socket::ip_any, port, true }));
+
+    // Connections are spread between the listeners, each is accepted by exactly one of them.
+    constexpr static const int connection_count = 64;
+    gtl::socket clients[connection_count];
+    for (gtl::socket& client : clients) {
+        REQUIRE(client.open(gtl::socket::tcp_client{ gtl::socket::ip_any, gtl::socket::port_any, gtl::socket::ip_loopback, port }));
+    }
+    int accepted = 0;
+    for (gtl::socket* listener : { &first, &second }) {
+        REQUIRE(listener->set_blocking(false));
+        gtl::socket connection;
+        while (listener->accept(connection)) {
+            ++accepted;
+        }
+    }
+    REQUIRE(accepted == connection_count);
+#endif
+}
+
+TEST(socket, function, accept_non_blocking) {
+    gtl::socket server;
+    REQUIRE(server.open(gtl::socket::tcp_server{ gtl::socket::ip_any, gtl::socket::port_any }));
+    gtl::socket::ip address;
+    unsigned short port = 0;
+    REQUIRE(server.get_config(address, port));
+    gtl::socket local;
+    REQUIRE(local.open(gtl::socket::tcp_client{ gtl::socket::ip_any, gtl::socket::port_any, gtl::socket::ip_loopback, port }));
+    gtl::socket remote;
+    REQUIRE(server.accept(remote, address, port, true));
+
+    // The accepted socket does not block without a separate call to set_blocking.
+    unsigned char buffer[16] = {};
+    REQUIRE(recv(remote.get_handle(), reinterpret_cast<char*>(buffer), sizeof(buffer), 0) < 0);
+}
+
+TEST(socket, function, read_write_tcp6) {
+    gtl::socket server;
+    REQUIRE(server.open(gtl::socket::tcp6_server{ gtl::socket::ip6_any, gtl::socket::port_any }));
+    gtl::socket::ip6 address = {};
+    unsigned short port = 0;
+    REQUIRE(server.get_config(address, port));
+    REQUIRE(address == gtl::socket::ip6_any);
+    REQUIRE(port != 0);
+
+    gtl::socket local;
+    REQUIRE(local.open(gtl::socket::tcp6_client{ gtl::socket::ip6_any, gtl::socket::port_any, gtl::socket::ip6_loopback, port }));
+    gtl::socket remote;
+    gtl::socket::ip6 address_remote = {};
+    unsigned short port_remote = 0;
+    REQUIRE(server.accept(remote, address_remote, port_remote));
+    REQUIRE(address_remote == gtl::socket::ip6_loopback);
+    REQUIRE(port_remote != 0);
+
+    const char* message = "Test message";
+    unsigned long long int message_length = testbench::string_length(message);
+    REQUIRE(local.write(reinterpret_cast<const unsigned char*>(message), message_length));
+    unsigned char buffer[128] = {};
+    unsigned long long int length = message_length;
+    REQUIRE(remote.read_exact(buffer, length));
+    REQUIRE(testbench::is_memory_same(message, buffer, message_length));
+}
+
+TEST(socket, function, read_write_udp6) {
+    gtl::socket socket1;
+    REQUIRE(socket1.open(gtl::socket::udp6_client{ gtl::socket::ip6_loopback, gtl::socket::port_any }));
+    gtl::socket socket2;
+    REQUIRE(socket2.open(gtl::socket::udp6_client{ gtl::socket::ip6_loopback, gtl::socket::port_any }));
+    gtl::socket::ip6 address = {};
+    unsigned short socket1_port = 0;
+    unsigned short socket2_port = 0;
+    REQUIRE(socket1.get_config(address, socket1_port));
+    REQUIRE(socket2.get_config(address, socket2_port));
+
+    const char* message = "Test message";
+    unsigned long long int message_length = testbench::string_length(message);
+    REQUIRE(socket1.write(reinterpret_cast<const unsigned char*>(message), message_length, gtl::socket::ip6_loopback, socket2_port));
+
+    unsigned char buffer[128] = {};
+    unsigned long long int length = 0;
+    unsigned short port = 0;
+    do {
+        std::this_thread::yield();
+        length = sizeof(buffer);
+        REQUIRE(socket2.read(buffer, length, address, port));
+    } while (length == 0);
+
+    REQUIRE(address == gtl::socket::ip6_loopback);
+    REQUIRE(port == socket1_port);
+    REQUIRE(length == message_length);
+    REQUIRE(testbench::is_memory_same(message, buffer, message_length));
+}
+
+TEST(socket, function, read_write_local) {
+    const std::string temp_filename = std::to_string(std::hash<std::string>{}(std::string(__FUNCTION__)));
+    PRINT("Temp filename for '%s' is: %s\n", __FUNCTION__, temp_filename.c_str());
+    IGNORED(std::remove(temp_filename.c_str()));
+
+#if defined(_WIN32)
+    gtl::socket server;
+    REQUIRE(!server.open(gtl::socket::local_server{ temp_filename.c_str() }));
+#else
+    {
+        gtl::socket server;
+        REQUIRE(server.open(gtl::socket::local_server{ temp_filename.c_str() }));
+
+        // A socket left behind by a previous server is replaced, unless asked not to.
+        gtl::socket replacement;
+        REQUIRE(!replacement.open(gtl::socket::local_server{ temp_filename.c_str(), SOMAXCONN, false }));
+        REQUIRE(replacement.open(gtl::socket::local_server{ temp_filename.c_str() }));
+        REQUIRE(server.open(gtl::socket::local_server{ temp_filename.c_str() }));
+
+        gtl::socket local;
+        REQUIRE(local.open(gtl::socket::local_client{ temp_filename.c_str() }));
+        gtl::socket remote;
+        REQUIRE(server.accept(remote));
+
+        const char* message = "Test message";
+        unsigned long long int message_length = testbench::string_length(message);
+        REQUIRE(local.write(reinterpret_cast<const unsigned char*>(message), message_length));
+        unsigned char buffer[128] = {};
+        unsigned long long int length = message_length;
+        REQUIRE(remote.read_exact(buffer, length));
+        REQUIRE(testbench::is_memory_same(message, buffer, message_length));
+    }
+
+    // Paths that do not fit in the address are rejected.
+    gtl::socket client;
+    REQUIRE(!client.open(gtl::socket::local_client{ std::string(200, 'x').c_str() }));
+    REQUIRE(!client.open(gtl::socket::local_client{ nullptr }));
+#endif
+
+    IGNORED(std::remove(temp_filename.c_str()));
+}
+
+TEST(socket, function, read_write_local_datagram) {
+    const std::string temp_filename = std::to_string(std::hash<std::string>{}(std::string(__FUNCTION__)));
+    PRINT("Temp filename for '%s' is: %s\n", __FUNCTION__, temp_filename.c_str());
+    IGNORED(std::remove(temp_filename.c_str()));
+
+#if defined(_WIN32)
+    gtl::socket receiver;
+    REQUIRE(!receiver.open(gtl::socket::local_datagram{ temp_filename.c_str() }));
+#else
+    {
+        gtl::socket receiver;
+        REQUIRE(receiver.open(gtl::socket::local_datagram{ temp_filename.c_str() }));
+        gtl::socket sender;
+        REQUIRE(sender.open(gtl::socket::local_datagram{ nullptr }));
+
+        // Message boundaries are kept.
+        const char* messages[] = { "first", "second message" };
+        for (const char* message : messages) {
+            unsigned long long int message_length = testbench::string_length(message);
+            REQUIRE(sender.write(reinterpret_cast<const unsigned char*>(message), message_length, temp_filename.c_str()));
+        }
+        for (const char* message : messages) {
+            unsigned char buffer[128] = {};
+            unsigned long long int length = sizeof(buffer);
+            REQUIRE(receiver.read(buffer, length));
+            REQUIRE(length == testbench::string_length(message));
+            REQUIRE(testbench::is_memory_same(message, buffer, length));
+        }
+    }
+#endif
+
+    IGNORED(std::remove(temp_filename.c_str()));
+}
+
+TEST(socket, function, open_pair) {
+    gtl::socket first;
+    gtl::socket second;
+#if defined(_WIN32)
+    REQUIRE(!gtl::socket::open_pair(first, second));
+#else
+    for (bool stream : { true, false }) {
+        REQUIRE(gtl::socket::open_pair(first, second, stream));
+        REQUIRE(first.is_open());
+        REQUIRE(second.is_open());
+
+        const unsigned char message[] = "message";
+        unsigned long long int length = sizeof(message);
+        REQUIRE(first.write(message, length));
+        REQUIRE(length == sizeof(message));
+        unsigned char buffer[16] = {};
+        REQUIRE(second.read_exact(buffer, length));
+        REQUIRE(testbench::is_memory_same(message, buffer, sizeof(message)));
+    }
+#endif
+}
+
+TEST(socket, function, read_write_handles) {
+    gtl::socket first;
+    gtl::socket second;
+#if defined(_WIN32)
+    REQUIRE(!gtl::socket::open_pair(first, second));
+#else
+    REQUIRE(gtl::socket::open_pair(first, second));
+
+    // Pass one end of another pair, and check the received handle is connected to the other end.
+    gtl::socket passed;
+    gtl::socket kept;
+    REQUIRE(gtl::socket::open_pair(passed, kept));
+
+    const unsigned char message[] = "handles";
+    unsigned long long int length = sizeof(message);
+    const int handles[] = { passed.get_handle() };
+    REQUIRE(!first.write_handles(message, length, handles, gtl::socket::handles_max + 1));
+    REQUIRE(first.write_handles(message, length, handles, 1));
+    REQUIRE(length == sizeof(message));
+
+    unsigned char buffer[16] = {};
+    length = sizeof(buffer);
+    int received[4] = { -1, -1, -1, -1 };
+    unsigned int received_count = 4;
+    REQUIRE(second.read_handles(buffer, length, received, received_count));
+    REQUIRE(length == sizeof(message));
+    REQUIRE(testbench::is_memory_same(message, buffer, sizeof(message)));
+    REQUIRE(received_count == 1);
+    REQUIRE(received[0] >= 0);
+
+    REQUIRE(::send(received[0], "x", 1, 0) == 1);
+    unsigned char byte = 0;
+    length = 1;
+    REQUIRE(kept.read_exact(&byte, length));
+    REQUIRE(byte == 'x');
+    REQUIRE(::close(received[0]) == 0);
+
+    // A message without handles is read with none.
+    length = sizeof(message);
+    REQUIRE(first.write_handles(message, length, nullptr, 0));
+    length = sizeof(buffer);
+    received_count = 4;
+    REQUIRE(second.read_handles(buffer, length, received, received_count));
+    REQUIRE(received_count == 0);
+#endif
+}
+
+TEST(socket, evaluate, local) {
+    // Round trips of a small message, as between services on the same machine.
+    constexpr static const int message_size = 64;
+    constexpr static const int round_trips = 1000;
+    unsigned char message[message_size] = {};
+
+    const auto round_trip = [&](const gtl::socket& client, const gtl::socket& server) {
+        int failures = 0;
+        for (int index = 0; index < round_trips; ++index) {
+            unsigned long long int length = message_size;
+            failures += client.write(message, length) ? 0 : 1;
+            failures += server.read_exact(message, length) ? 0 : 1;
+            failures += server.write(message, length) ? 0 : 1;
+            failures += client.read_exact(message, length) ? 0 : 1;
+        }
+        return failures;
+    };
+
+    gtl::socket tcp_server;
+    REQUIRE(tcp_server.open(gtl::socket::tcp_server{ gtl::socket::ip_any, gtl::socket::port_any }));
+    gtl::socket::ip address;
+    unsigned short port = 0;
+    REQUIRE(tcp_server.get_config(address, port));
+    gtl::socket tcp_client;
+    REQUIRE(tcp_client.open(gtl::socket::tcp_client{ gtl::socket::ip_any, gtl::socket::port_any, gtl::socket::ip_loopback, port }));
+    gtl::socket tcp_remote;
+    REQUIRE(tcp_server.accept(tcp_remote));
+    REQUIRE(tcp_client.set_no_delay(true));
+    REQUIRE(tcp_remote.set_no_delay(true));
+
+    PRINT("Round trips over loopback tcp: %f\n", testbench::benchmark([&]() {
+        REQUIRE(round_trip(tcp_client, tcp_remote) == 0);
+    }, 10));
+
+    gtl::socket local_client;
+    gtl::socket local_remote;
+    if (gtl::socket::open_pair(local_client, local_remote)) {
+        PRINT("Round trips over a local socket: %f\n", testbench::benchmark([&]() {
+            REQUIRE(round_trip(local_client, local_remote) == 0);
+        }, 10));
+    }
+}
+
+TEST(socket, evaluate, read) {
+    gtl::socket server;
+    REQUIRE(server.open(gtl::socket::tcp_server{ gtl::socket::ip_any, gtl::socket::port_any }));
+    gtl::socket::ip address;
+    unsigned short port = 0;
+    REQUIRE(server.get_config(address, port));
+    gtl::socket local;
+    REQUIRE(local.open(gtl::socket::tcp_client{ gtl::socket::ip_any, gtl::socket::port_any, gtl::socket::ip_loopback, port }));
+    gtl::socket remote;
+    REQUIRE(server.accept(remote));
+
+    constexpr static const unsigned long long int message_count = 1000;
+    constexpr static const unsigned long long int message_size = 64;
+    unsigned char messages[message_count * message_size] = {};
+
+    // Queue every message, then read them one at a time counting the system calls used.
+    const auto send_all = [&]() {
+        unsigned long long int sent = 0;
+        while (sent < sizeof(messages)) {
+            unsigned long long int length = sizeof(messages) - sent;
+            REQUIRE(local.write(messages + sent, length));
+            sent += length;
+        }
+    };
+
+#if defined(_WIN32)
+    using available_type = unsigned long int;
+#else
+    using available_type = int;
+#endif
+
+    unsigned long long int calls = 0;
+    PRINT("Read with FIONREAD then recv: %f\n", testbench::benchmark([&]() {
+        send_all();
+        unsigned long long int received = 0;
+        while (received < sizeof(messages)) {
+            available_type available = 0;
+            ++calls;
+            REQUIRE(ioctlsocket(remote.get_handle(), FIONREAD, &available) >= 0);
+            if (available == 0) {
+                continue;
+            }
+            ++calls;
+            const long long int length = recv(remote.get_handle(), reinterpret_cast<char*>(messages + received), message_size, 0);
+            REQUIRE(length > 0);
+            received += static_cast<unsigned long long int>(length);
+        }
+    }, 10));
+    PRINT("System calls per message: %f\n", static_cast<double>(calls) / static_cast<double>(message_count * 10));
+
+    calls = 0;
+    PRINT("Read with a single non-blocking recv: %f\n", testbench::benchmark([&]() {
+        send_all();
+        unsigned long long int received = 0;
+        while (received < sizeof(messages)) {
+            unsigned long long int length = message_size;
+            ++calls;
+            REQUIRE(remote.read(messages + received, length));
+            received += length;
+        }
+    }, 10));
+    PRINT("System calls per message: %f\n", static_cast<double>(calls) / static_cast<double>(message_count * 10));
+
+    PRINT("Read exact: %f\n", testbench::benchmark([&]() {
+        send_all();
+        for (unsigned long long int index = 0; index < message_count; ++index) {
+            unsigned long long int length = message_size;
+            REQUIRE(remote.read_exact(messages + index * message_size, length));
+        }
+    }, 10));
+}
+
+TEST(socket, function, read_write_batch) {
+    gtl::socket sender;
+    REQUIRE(sender.open(gtl::socket::udp_client{ gtl::socket::ip_loopback, gtl::socket::port_any }));
+    gtl::socket receiver;
+    REQUIRE(receiver.open(gtl::socket::udp_client{ gtl::socket::ip_loopback, gtl::socket::port_any }));
+    gtl::socket::ip address;
+    unsigned short sender_port = 0;
+    REQUIRE(sender.get_config(address, sender_port));
+    unsigned short receiver_port = 0;
+    REQUIRE(receiver.get_config(address, receiver_port));
+
+    constexpr static const unsigned long long int datagram_count = 100;
+
+    // Nothing has been sent, so nothing is read.
+    unsigned char received_data[datagram_count][32] = {};
+    gtl::socket::datagram received[datagram_count] = {};
+    for (unsigned long long int index = 0; index < datagram_count; ++index) {
+        received[index] = gtl::socket::datagram{ received_data[index], sizeof(received_data[index]), {}, 0, 0 };
+    }
+    unsigned long long int count = datagram_count;
+    REQUIRE(receiver.read_batch(received, count));
+    REQUIRE(count == 0);
+
+    // Each datagram holds its index, repeated to make its length vary.
+    unsigned char sent_data[datagram_count][32] = {};
+    gtl::socket::datagram sent[datagram_count] = {};
+    for (unsigned long long int index = 0; index < datagram_count; ++index) {
+        for (unsigned char& character : sent_data[index]) {
+            character = static_cast<unsigned char>(index);
+        }
+        sent[index] = gtl::socket::datagram{ sent_data[index], 1 + index % 32, gtl::socket::ip_loopback, receiver_port, 0 };
+    }
+    count = datagram_count;
+    REQUIRE(sender.write_batch(sent, count));
+    REQUIRE(count == datagram_count);
+
+    unsigned long long int total = 0;
+    while (total < datagram_count) {
+        for (unsigned long long int index = total; index < datagram_count; ++index) {
+            received[index].length = sizeof(received_data[index]);
+        }
+        count = datagram_count - total;
+        REQUIRE(receiver.read_batch(received + total, count));
+        total += count;
+    }
+    for (unsigned long long int index = 0; index < datagram_count; ++index) {
+        REQUIRE(received[index].length == 1 + index % 32);
+        REQUIRE(received[index].data[0] == index);
+        REQUIRE(received[index].address == gtl::socket::ip_loopback);
+        REQUIRE(received[index].port == sender_port);
+        REQUIRE(received[index].segment_size == 0);
+    }
+}
+
+TEST(socket, function, segmentation_offload) {
+#if defined(linux) || defined(__linux) || defined(__linux__)
+    gtl::socket sender;
+    REQUIRE(sender.open(gtl::socket::udp_client{ gtl::socket::ip_loopback, gtl::socket::port_any }));
+    gtl::socket receiver;
+    REQUIRE(receiver.open(gtl::socket::udp_client{ gtl::socket::ip_loopback, gtl::socket::port_any }));
+    REQUIRE(receiver.set_receive_offload(true));
+    gtl::socket::ip address;
+    unsigned short receiver_port = 0;
+    REQUIRE(receiver.get_config(address, receiver_port));
+
+    // One buffer of ten segments is split by the operating system, and may arrive whole or as separate datagrams.
+    unsigned char sent_data[1000] = {};
+    for (unsigned long long int index = 0; index < sizeof(sent_data); ++index) {
+        sent_data[index] = static_cast<unsigned char>(index / 100);
+    }
+    gtl::socket::datagram sent = { sent_data, sizeof(sent_data), gtl::socket::ip_loopback, receiver_port, 100 };
+    unsigned long long int count = 1;
+    REQUIRE(sender.write_batch(&sent, count));
+    REQUIRE(count == 1);
+
+    unsigned char received_data[2000] = {};
+    unsigned long long int total = 0;
+    while (total < sizeof(sent_data)) {
+        gtl::socket::datagram received = { received_data + total, sizeof(received_data) - total, {}, 0, 0 };
+        count = 1;
+        REQUIRE(receiver.read_batch(&received, count));
+        if (count == 1) {
+            REQUIRE((received.segment_size == 0) || (received.segment_size == 100));
+            total += received.length;
+        }
+    }
+    REQUIRE(total == sizeof(sent_data));
+    REQUIRE(testbench::is_memory_same(sent_data, received_data, sizeof(sent_data)));
+#endif
+}
+
+TEST(socket, evaluate, read_write_batch) {
+    gtl::socket sender;
+    REQUIRE(sender.open(gtl::socket::udp_client{ gtl::socket::ip_loopback, gtl::socket::port_any }));
+    gtl::socket receiver;
+    REQUIRE(receiver.open(gtl::socket::udp_client{ gtl::socket::ip_loopback, gtl::socket::port_any }));
+    gtl::socket::ip address;
+    unsigned short receiver_port = 0;
+    REQUIRE(receiver.get_config(address, receiver_port));
+
+    // Datagrams are sent in rounds small enough for the receive buffer, so none are dropped.
+    constexpr static const unsigned long long int round_size = 128;
+    constexpr static const unsigned long long int round_count = 100;
+    unsigned char data[round_size][64] = {};
+    gtl::socket::datagram datagrams[round_size] = {};
+
+    PRINT("Write and read each datagram: %f\n", testbench::benchmark([&]() {
+        for (unsigned long long int round = 0; round < round_count; ++round) {
+            for (unsigned long long int index = 0; index < round_size; ++index) {
+                unsigned long long int length = sizeof(data[index]);
+                REQUIRE(sender.write(data[index], length, gtl::socket::ip_loopback, receiver_port));
+            }
+            for (unsigned long long int index = 0; index < round_size;) {
+                unsigned long long int length = sizeof(data[index]);
+                REQUIRE(receiver.read(data[index], length));
+                index += (length > 0) ? 1 : 0;
+            }
+        }
+    }, 1));
+
+    PRINT("Write and read datagrams in batches: %f\n", testbench::benchmark([&]() {
+        for (unsigned long long int round = 0; round < round_count; ++round) {
+            for (unsigned long long int index = 0; index < round_size; ++index) {
+                datagrams[index] = gtl::socket::datagram{ data[index], sizeof(data[index]), gtl::socket::ip_loopback, receiver_port, 0 };
+            }
+            unsigned long long int count = round_size;
+            REQUIRE(sender.write_batch(datagrams, count));
+            for (unsigned long long int total = 0; total < round_size;) {
+                count = round_size - total;
+                REQUIRE(receiver.read_batch(datagrams + total, count));
+                total += count;
+            }
+        }
+    }, 1));
+}
@@ -0,0 +1,54 @@
+/*
+Copyright (C) 2018-2024 Geoffrey Daniels. https://gpdaniels.com/
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, version 3 of the License only.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+#ifndef GTL_IO_SOCKETS_TEST_HPP
+#define GTL_IO_SOCKETS_TEST_HPP
+
+#include <testbench/require.tests.hpp>
+
+#include <io/socket>
+
+/// @brief A tcp server on the loopback interface, to make connected pairs of sockets.
+struct loopback_server {
+    gtl::socket listener;
+    unsigned short port = 0;
+
+    loopback_server() {
+        REQUIRE(this->listener.open(gtl::socket::tcp_server{ gtl::socket::ip_any, gtl::socket::port_any }));
+        gtl::socket::ip address;
+        REQUIRE(this->listener.get_config(address, this->port));
+    }
+
+    /// @brief Connect a pair of sockets, the connection completes in the listen backlog, so it can be accepted after connecting.
+    void connect(gtl::socket& local, gtl::socket& remote) {
+        REQUIRE(local.open(gtl::socket::tcp_client{ gtl::socket::ip_any, gtl::socket::port_any, gtl::socket::ip_loopback, this->port }));
+        REQUIRE(this->listener.accept(remote));
+    }
+};
+
+/// @brief A connected pair of tcp sockets on the loopback interface.
+struct loopback_pair {
+    gtl::socket local;
+    gtl::socket remote;
+
+    loopback_pair() {
+        loopback_server server;
+        server.connect(this->local, this->remote);
+    }
+};
+
+#endif // GTL_IO_SOCKETS_TEST_HPP
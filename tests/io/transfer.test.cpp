@@ -0,0 +1,222 @@
+/*
+Copyright (C) 2018-2024 Geoffrey Daniels. https://gpdaniels.com/
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, version 3 of the License only.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <testbench/main.tests.hpp>
+
+#include <testbench/benchmark.tests.hpp>
+#include <testbench/ignored.tests.hpp>
+#include <testbench/require.tests.hpp>
+
+#include <io/files.test.hpp>
+#include <io/sockets.test.hpp>
+#include <io/transfer>
+
+#if defined(_MSC_VER)
+#pragma warning(push, 0)
+#endif
+
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+
+namespace {
+    /// @brief Read from a socket until a number of characters have arrived.
+    std::string read_socket(const gtl::socket& socket, gtl::file::size_type size) {
+        std::string received;
+        std::vector<unsigned char> buffer(64 * 1024);
+        while (received.size() < size) {
+            unsigned long long int length = buffer.size();
+            if (!socket.read(buffer.data(), length)) {
+                break;
+            }
+            if (length == 0) {
+                std::this_thread::yield();
+            }
+            received.append(reinterpret_cast<const char*>(buffer.data()), static_cast<gtl::file::size_type>(length));
+        }
+        return received;
+    }
+}
+
+TEST(transfer, traits, standard) {
+    REQUIRE((std::is_pod<gtl::transfer>::value == true));
+
+    REQUIRE((std::is_trivial<gtl::transfer>::value == true));
+
+    REQUIRE((std::is_trivially_copyable<gtl::transfer>::value == true));
+
+    REQUIRE((std::is_standard_layout<gtl::transfer>::value == true));
+}
+
+TEST(transfer, function, closed) {
+    gtl::file file;
+    gtl::socket socket;
+    gtl::file::size_type length = 10;
+    REQUIRE(gtl::transfer::copy(file, file, length) == false);
+    REQUIRE(length == 0);
+    length = 10;
+    REQUIRE(gtl::transfer::send(file, socket, length) == false);
+    REQUIRE(length == 0);
+    length = 10;
+    REQUIRE(gtl::transfer::receive(socket, file, length) == false);
+    REQUIRE(length == 0);
+}
+
+TEST(transfer, function, copy) {
+    const std::string source_filename = std::to_string(std::hash<std::string>{}(std::string(__FUNCTION__) + "source"));
+    const std::string target_filename = std::to_string(std::hash<std::string>{}(std::string(__FUNCTION__) + "target"));
+    PRINT("Temp filenames for '%s' are: %s %s\n", __FUNCTION__, source_filename.c_str(), target_filename.c_str());
+    IGNORED(std::remove(source_filename.c_str()));
+    IGNORED(std::remove(target_filename.c_str()));
+
+    const std::string contents = make_contents(300000);
+    write_file(source_filename, contents);
+
+    gtl::file source(source_filename.c_str());
+    gtl::file target(target_filename.c_str(), gtl::file::access_type::read_and_write, gtl::file::creation_type::create_or_open, gtl::file::cursor_type::start_of_truncated);
+
+    gtl::file::size_type length = contents.size();
+    REQUIRE(gtl::transfer::copy(source, target, length));
+    REQUIRE(length == contents.size());
+    REQUIRE(read_file(target_filename) == contents);
+
+    // Copy part of the file to a later position, asking for more than remains.
+    length = 1000000;
+    REQUIRE(gtl::transfer::copy(source, target, length, 299990, 300000));
+    REQUIRE(length == 10);
+    REQUIRE(read_file(target_filename) == contents + contents.substr(299990));
+
+    // The cursors are not used or moved.
+    gtl::file::size_type position = 1;
+    REQUIRE(source.get_cursor_position(position));
+    REQUIRE(position == 0);
+
+    IGNORED(std::remove(source_filename.c_str()));
+    IGNORED(std::remove(target_filename.c_str()));
+}
+
+TEST(transfer, function, copy_fallback) {
+#if (defined(linux) || defined(__linux) || defined(__linux__))
+    const std::string target_filename = std::to_string(std::hash<std::string>{}(std::string(__FUNCTION__)));
+    PRINT("Temp filename for '%s' is: %s\n", __FUNCTION__, target_filename.c_str());
+    IGNORED(std::remove(target_filename.c_str()));
+
+    // The kernel cannot copy from a character device, so this is copied through a buffer.
+    gtl::file source("/dev/zero");
+    REQUIRE(source.is_open());
+    gtl::file target(target_filename.c_str(), gtl::file::access_type::read_and_write, gtl::file::creation_type::create_or_open, gtl::file::cursor_type::start_of_truncated);
+    gtl::file::size_type length = 200000;
+    REQUIRE(gtl::transfer::copy(source, target, length));
+    REQUIRE(length == 200000);
+    REQUIRE(read_file(target_filename) == std::string(200000, '\0'));
+
+    IGNORED(std::remove(target_filename.c_str()));
+#endif
+}
+
+TEST(transfer, function, send) {
+    const std::string source_filename = std::to_string(std::hash<std::string>{}(std::string(__FUNCTION__)));
+    PRINT("Temp filename for '%s' is: %s\n", __FUNCTION__, source_filename.c_str());
+    IGNORED(std::remove(source_filename.c_str()));
+
+    const std::string contents = make_contents(1000000);
+    write_file(source_filename, contents);
+    gtl::file source(source_filename.c_str());
+
+    loopback_pair sockets;
+    std::string received;
+    std::thread reader([&]() {
+        received = read_socket(sockets.local, contents.size() - 100);
+    });
+    gtl::file::size_type length = contents.size();
+    REQUIRE(gtl::transfer::send(source, sockets.remote, length, 100));
+    REQUIRE(length == contents.size() - 100);
+    reader.join();
+    REQUIRE(received == contents.substr(100));
+
+    IGNORED(std::remove(source_filename.c_str()));
+}
+
+TEST(transfer, function, receive) {
+    const std::string target_filename = std::to_string(std::hash<std::string>{}(std::string(__FUNCTION__)));
+    PRINT("Temp filename for '%s' is: %s\n", __FUNCTION__, target_filename.c_str());
+    IGNORED(std::remove(target_filename.c_str()));
+
+    const std::string contents = make_contents(500000);
+    gtl::file target(target_filename.c_str(), gtl::file::access_type::read_and_write, gtl::file::creation_type::create_or_open, gtl::file::cursor_type::start_of_truncated);
+
+    loopback_pair sockets;
+    std::thread writer([&]() {
+        unsigned long long int written = 0;
+        while (written < contents.size()) {
+            unsigned long long int length = contents.size() - written;
+            REQUIRE(sockets.local.write(reinterpret_cast<const unsigned char*>(contents.data() + written), length));
+            written += length;
+        }
+    });
+    gtl::file::size_type received = 0;
+    while (received < contents.size()) {
+        gtl::file::size_type length = contents.size() - received;
+        REQUIRE(gtl::transfer::receive(sockets.remote, target, length, received));
+        if (length == 0) {
+            std::this_thread::yield();
+        }
+        received += length;
+    }
+    writer.join();
+    REQUIRE(received == contents.size());
+    REQUIRE(read_file(target_filename) == contents);
+
+    IGNORED(std::remove(target_filename.c_str()));
+}
+
+TEST(transfer, evaluate, copy) {
+    const std::string source_filename = std::to_string(std::hash<std::string>{}(std::string(__FUNCTION__) + "source"));
+    const std::string target_filename = std::to_string(std::hash<std::string>{}(std::string(__FUNCTION__) + "target"));
+    PRINT("Temp filenames for '%s' are: %s %s\n", __FUNCTION__, source_filename.c_str(), target_filename.c_str());
+    IGNORED(std::remove(source_filename.c_str()));
+
+    constexpr static const gtl::file::size_type size = 32 * 1024 * 1024;
+    write_file(source_filename, make_contents(size));
+    gtl::file source(source_filename.c_str());
+
+    PRINT("gtl::file::read and write: %f\n", testbench::benchmark([&]() {
+        gtl::file target(target_filename.c_str(), gtl::file::access_type::write_only, gtl::file::creation_type::create_or_open, gtl::file::cursor_type::start_of_truncated);
+        std::vector<char> buffer(gtl::transfer::buffer_size);
+        for (gtl::file::size_type offset = 0; offset < size; offset += buffer.size()) {
+            gtl::file::size_type length = buffer.size();
+            IGNORED(source.read_at(buffer.data(), length, offset));
+            IGNORED(target.write(buffer.data(), length));
+        }
+    }, 3));
+
+    PRINT("gtl::transfer::copy:       %f\n", testbench::benchmark([&]() {
+        gtl::file target(target_filename.c_str(), gtl::file::access_type::write_only, gtl::file::creation_type::create_or_open, gtl::file::cursor_type::start_of_truncated);
+        gtl::file::size_type length = size;
+        IGNORED(gtl::transfer::copy(source, target, length));
+    }, 3));
+
+    REQUIRE(read_file(target_filename).size() == size);
+
+    IGNORED(std::remove(source_filename.c_str()));
+    IGNORED(std::remove(target_filename.c_str()));
+}
@@ -0,0 +1,216 @@
+/*
+Copyright (C) 2018-2024 Geoffrey Daniels. https://gpdaniels.com/
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, version 3 of the License only.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <testbench/main.tests.hpp>
+
+#include <testbench/benchmark.tests.hpp>
+#include <testbench/require.tests.hpp>
+
+#include <io/sockets.test.hpp>
+#include <io/zero_copy_sender>
+
+#if defined(_MSC_VER)
+#pragma warning(push, 0)
+#endif
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+
+namespace {
+    /// @brief A connected pair of tcp sockets on the loopback interface, with a thread reading everything sent to the remote end.
+    struct connection : loopback_pair {
+        std::thread reader;
+        std::atomic<unsigned long long int> received;
+        std::atomic<unsigned long long int> checksum;
+
+        connection()
+            : received(0)
+            , checksum(0) {
+            this->reader = std::thread([this]() {
+                std::vector<unsigned char> buffer(64 * 1024);
+                for (;;) {
+                    const long long int length = recv(this->remote.get_handle(), reinterpret_cast<char*>(buffer.data()), static_cast<int>(buffer.size()), 0);
+                    if (length <= 0) {
+                        break;
+                    }
+                    unsigned long long int sum = 0;
+                    for (long long int index = 0; index < length; ++index) {
+                        sum += buffer[static_cast<std::size_t>(index)];
+                    }
+                    this->checksum += sum;
+                    this->received += static_cast<unsigned long long int>(length);
+                }
+            });
+        }
+
+        ~connection() {
+            shutdown(this->local.get_handle(), SD_BOTH);
+            this->reader.join();
+        }
+    };
+
+    unsigned long long int sum(const std::vector<unsigned char>& buffer) {
+        unsigned long long int total = 0;
+        for (unsigned char value : buffer) {
+            total += value;
+        }
+        return total;
+    }
+}
+
+TEST(zero_copy_sender, traits, standard) {
+    REQUIRE((std::is_pod<gtl::zero_copy_sender>::value == false));
+
+    REQUIRE((std::is_trivial<gtl::zero_copy_sender>::value == false));
+
+    REQUIRE((std::is_trivially_copyable<gtl::zero_copy_sender>::value == false));
+
+    REQUIRE((std::is_copy_constructible<gtl::zero_copy_sender>::value == false));
+}
+
+TEST(zero_copy_sender, constructor, closed) {
+    gtl::socket socket;
+    unsigned int released = 0;
+    gtl::zero_copy_sender sender(socket, [&released](const unsigned char*, unsigned long long int) {
+        ++released;
+    });
+    REQUIRE(!sender.is_zero_copy());
+    REQUIRE(sender.pending_count() == 0);
+    REQUIRE(sender.copied() == 0);
+
+    // A failed write still releases the buffer.
+    const unsigned char buffer[4] = {};
+    REQUIRE(!sender.write(buffer, sizeof(buffer)));
+    REQUIRE(released == 1);
+}
+
+TEST(zero_copy_sender, function, write_small) {
+    connection pair;
+    std::vector<unsigned char> buffer(1024, 7);
+    unsigned int released = 0;
+    gtl::zero_copy_sender sender(pair.local, [&](const unsigned char* data, unsigned long long int length) {
+        REQUIRE(data == buffer.data());
+        REQUIRE(length == buffer.size());
+        ++released;
+    });
+
+    // Below the threshold the buffer is copied, so it is released immediately.
+    REQUIRE(sender.write(buffer.data(), buffer.size()));
+    REQUIRE(released == 1);
+    REQUIRE(sender.pending_count() == 0);
+}
+
+TEST(zero_copy_sender, function, write) {
+    connection pair;
+#if defined(linux) || defined(__linux) || defined(__linux__)
+    REQUIRE(pair.local.set_zero_copy(true));
+#endif
+
+    constexpr static const int buffer_count = 8;
+    std::vector<std::vector<unsigned char>> buffers;
+    unsigned long long int expected_checksum = 0;
+    for (int index = 0; index < buffer_count; ++index) {
+        buffers.emplace_back(1024 * 1024, static_cast<unsigned char>(index + 1));
+        expected_checksum += sum(buffers.back());
+    }
+
+    // Buffers are released once each, in the order written.
+    std::vector<const unsigned char*> released;
+    {
+        gtl::zero_copy_sender sender(pair.local, [&released](const unsigned char* data, unsigned long long int) {
+            released.push_back(data);
+        });
+#if defined(linux) || defined(__linux) || defined(__linux__)
+        REQUIRE(sender.is_zero_copy());
+#endif
+        for (const std::vector<unsigned char>& buffer : buffers) {
+            REQUIRE(sender.write(buffer.data(), buffer.size()));
+        }
+        REQUIRE(sender.wait());
+        REQUIRE(sender.pending_count() == 0);
+        PRINT("Zero copy writes copied by the kernel: %llu\n", sender.copied());
+    }
+    REQUIRE(released.size() == buffer_count);
+    for (int index = 0; index < buffer_count; ++index) {
+        REQUIRE(released[static_cast<std::size_t>(index)] == buffers[static_cast<std::size_t>(index)].data());
+    }
+
+    for (int attempt = 0; (attempt < 5000) && (pair.received < buffer_count * 1024 * 1024); ++attempt) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    REQUIRE(pair.received == buffer_count * 1024 * 1024);
+    REQUIRE(pair.checksum == expected_checksum);
+}
+
+TEST(zero_copy_sender, function, destructor) {
+    connection pair;
+    std::vector<unsigned char> buffer(1024 * 1024, 1);
+    unsigned int released = 0;
+    {
+        gtl::zero_copy_sender sender(pair.local, [&released](const unsigned char*, unsigned long long int) {
+            ++released;
+        });
+        REQUIRE(sender.write(buffer.data(), buffer.size()));
+    }
+    REQUIRE(released == 1);
+}
+
+TEST(zero_copy_sender, evaluate, write) {
+    constexpr static const unsigned long long int buffer_size = 8 * 1024 * 1024;
+    constexpr static const int buffer_count = 4;
+    std::vector<std::vector<unsigned char>> buffers(buffer_count, std::vector<unsigned char>(buffer_size, 1));
+
+    connection pair;
+    unsigned long long int sent = 0;
+
+    PRINT("Copied writes of %d %llu byte buffers: %f\n", buffer_count, buffer_size, testbench::benchmark([&]() {
+        for (const std::vector<unsigned char>& buffer : buffers) {
+            unsigned long long int written = 0;
+            while (written < buffer.size()) {
+                unsigned long long int length = buffer.size() - written;
+                REQUIRE(pair.local.write(buffer.data() + written, length));
+                written += length;
+            }
+            sent += written;
+        }
+    }, 10));
+
+    {
+        gtl::zero_copy_sender sender(pair.local, [](const unsigned char*, unsigned long long int) {});
+        PRINT("Zero copy writes of %d %llu byte buffers: %f\n", buffer_count, buffer_size, testbench::benchmark([&]() {
+            for (const std::vector<unsigned char>& buffer : buffers) {
+                REQUIRE(sender.write(buffer.data(), buffer.size()));
+                sent += buffer.size();
+            }
+            REQUIRE(sender.wait());
+        }, 10));
+        // The kernel copies data sent to a loopback address, so zero copy only gains across a network.
+        PRINT("Zero copy writes copied by the kernel: %llu\n", sender.copied());
+    }
+
+    for (int attempt = 0; (attempt < 5000) && (pair.received < sent); ++attempt) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    REQUIRE(pair.received == sent);
+}
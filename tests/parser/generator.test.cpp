@@ -21,6 +21,9 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 #include <parser/generator>
 
+#include <container/arena>
+#include <container/pool_allocator>
+
 TEST(parsers, constructor, empty) {
     gtl::generator<char> generator;
     testbench::do_not_optimise_away(generator);
@@ -164,6 +167,27 @@ TEST(parser, element, disjunction) {
     REQUIRE(error.empty());
 }
 
+TEST(parser, element, allocators) {
+    std::string test_input = R"(Ab02)";
+
+    using pool_parser = gtl::generator<char, gtl::pool_allocator<char>>;
+    pool_parser pool_grammar = pool_parser::terminal_any('A') + pool_parser::terminal_any('b') + pool_parser::terminal_any('0') + pool_parser::terminal_any('2');
+    pool_parser::parse_forest_type pool_forest;
+    for (char character : test_input) {
+        pool_grammar.parse(character, pool_forest);
+    }
+    REQUIRE(pool_grammar.finalise(pool_forest, nullptr, nullptr));
+
+    using arena_parser = gtl::generator<char, gtl::arena_allocator<char>>;
+    gtl::arena arena;
+    arena_parser arena_grammar = arena_parser::terminal_any('A') + arena_parser::terminal_any('b') + arena_parser::terminal_any('0') + arena_parser::terminal_any('2');
+    arena_parser::parse_forest_type arena_forest{ arena_parser::parse_forest_type::allocator_type(arena) };
+    for (char character : test_input) {
+        arena_grammar.parse(character, arena_forest);
+    }
+    REQUIRE(arena_grammar.finalise(arena_forest, nullptr, nullptr));
+}
+
 TEST(parser, element, recurse) {
     constexpr static const size_t grammar_count = 3;
 
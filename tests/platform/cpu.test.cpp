@@ -85,10 +85,29 @@ TEST(cpu, function, has_xxx) {
 
     testbench::do_not_optimise_away(cpu.has_avx512_foundation());
 
+    testbench::do_not_optimise_away(cpu.has_osxsave());
+    testbench::do_not_optimise_away(cpu.has_os_avx_support());
+    testbench::do_not_optimise_away(cpu.has_os_avx512_support());
+
     testbench::do_not_optimise_away(cpu.has_bmi());
     testbench::do_not_optimise_away(cpu.has_bmi2());
 }
 
+TEST(cpu, function, has_os_support) {
+    gtl::cpu cpu;
+
+    // The operating system can only report the register states it saves if it has enabled xgetbv.
+    if (!cpu.has_osxsave()) {
+        REQUIRE(!cpu.has_os_avx_support());
+        REQUIRE(!cpu.has_os_avx512_support());
+    }
+
+    // Saving the avx512 registers requires saving the avx registers.
+    if (cpu.has_os_avx512_support()) {
+        REQUIRE(cpu.has_os_avx_support());
+    }
+}
+
 TEST(cpu, evaluate, print_flags) {
     gtl::cpu cpu;
     PRINT("get_max_leaf_id:             %d\n", cpu.get_max_leaf_id());
@@ -115,6 +134,10 @@ TEST(cpu, evaluate, print_flags) {
 
     PRINT("has_avx512f:                 %d\n", cpu.has_avx512_foundation());
 
+    PRINT("has_osxsave:                 %d\n", cpu.has_osxsave());
+    PRINT("has_os_avx_support:          %d\n", cpu.has_os_avx_support());
+    PRINT("has_os_avx512_support:       %d\n", cpu.has_os_avx512_support());
+
     PRINT("has_bmi:                     %d\n", cpu.has_bmi());
     PRINT("has_bmi2:                    %d\n", cpu.has_bmi2());
 }
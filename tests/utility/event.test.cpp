@@ -16,6 +16,7 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 #include <testbench/main.tests.hpp>
 
+#include <testbench/benchmark.tests.hpp>
 #include <testbench/require.tests.hpp>
 #include <testbench/template.tests.hpp>
 
@@ -25,8 +26,13 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #pragma warning(push, 0)
 #endif
 
+#include <atomic>
+#include <chrono>
 #include <functional>
+#include <memory>
+#include <thread>
 #include <type_traits>
+#include <vector>
 
 #if defined(_MSC_VER)
 #pragma warning(pop)
@@ -105,3 +111,419 @@ TEST(event, evaluate, emit_and_process_invokable_event) {
 
     REQUIRE(test.value == 1, "Expected the value of the event to have been propadated to the test class.");
 }
+
+struct counted_event {
+    static inline std::atomic<int> alive = { 0 };
+    int value;
+
+    counted_event(int value_)
+        : value(value_) {
+        ++counted_event::alive;
+    }
+
+    counted_event(counted_event&& other)
+        : value(other.value) {
+        ++counted_event::alive;
+    }
+
+    ~counted_event() {
+        --counted_event::alive;
+    }
+};
+
+class counted_subscriber final
+    : public gtl::event_queue<counted_event> {
+public:
+    std::vector<int> values;
+
+private:
+    void on_event(counted_event& data) override {
+        this->values.push_back(data.value);
+    }
+
+public:
+    void process() {
+        gtl::event_queue<counted_event>::process_events();
+    }
+};
+
+TEST(event, evaluate, shared_between_subscribers) {
+    {
+        counted_subscriber first;
+        counted_subscriber second;
+        counted_subscriber unprocessed;
+
+        for (int index = 0; index < 10; ++index) {
+            gtl::event_manager<counted_event>::emit(counted_event(index));
+        }
+        gtl::event_manager<counted_event>::emit(std::make_shared<counted_event>(10));
+        gtl::event_manager<counted_event>::emit(counted_event(11), &second);
+
+        // Each event is held once however many subscribers it is delivered to.
+        REQUIRE(counted_event::alive == 12, "Expected one live copy of each event before processing.");
+
+        first.process();
+        REQUIRE(first.values.size() == 11, "Expected the first subscriber to receive every broadcast event.");
+        REQUIRE(counted_event::alive == 12, "Expected events to be kept alive until every subscriber has processed them.");
+
+        second.process();
+        REQUIRE(second.values.size() == 12, "Expected the second subscriber to receive every broadcast event and its own event.");
+        REQUIRE(second.values[11] == 11, "Expected the targeted event to be received last.");
+    }
+
+    // Events that were never processed are released when their subscriber is destroyed.
+    REQUIRE(counted_event::alive == 0, "Expected every event to have been released.");
+}
+
+TEST(event, evaluate, order_when_full) {
+    counted_subscriber subscriber;
+
+    // Emit more events than fit in the ring so that some spill into the overflow.
+    for (int index = 0; index < 10000; ++index) {
+        gtl::event_manager<counted_event>::emit(counted_event(index));
+    }
+    subscriber.process();
+
+    REQUIRE(subscriber.values.size() == 10000, "Expected every event to be received.");
+    bool ordered = true;
+    for (int index = 0; index < 10000; ++index) {
+        ordered = ordered && (subscriber.values[static_cast<unsigned long long int>(index)] == index);
+    }
+    REQUIRE(ordered, "Expected events to be received in the order they were emitted.");
+}
+
+TEST(event, evaluate, emit_while_processing) {
+    test_class test;
+
+    // A handler that emits an event must not block on the queue it is being processed from.
+    gtl::event_manager<std::function<void(void)>>::emit([&test]() {
+        gtl::event_manager<test_event>::emit(test_event{ 2 });
+    });
+    test.process();
+    REQUIRE(test.value == 0, "Expected the event emitted by the handler to be queued.");
+
+    test.process();
+    REQUIRE(test.value == 2, "Expected the event emitted by the handler to have been processed.");
+}
+
+struct batched_event {
+    int value;
+};
+
+class batched_subscriber final
+    : private gtl::event_queue<batched_event> {
+public:
+    std::vector<int> values;
+    bool reemit = false;
+
+private:
+    void on_event(batched_event& data) override {
+        this->values.push_back(data.value);
+        if (this->reemit) {
+            gtl::event_manager<batched_event>::emit(batched_event{ data.value + 1 });
+        }
+        if (data.value < 0) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        }
+    }
+
+public:
+    unsigned long long int process() {
+        return gtl::event_queue<batched_event>::process_events();
+    }
+
+    unsigned long long int process(unsigned long long int batch_limit) {
+        return gtl::event_queue<batched_event>::process_events(batch_limit);
+    }
+
+    unsigned long long int process(unsigned long long int batch_limit, std::chrono::milliseconds time_budget) {
+        return gtl::event_queue<batched_event>::process_events(batch_limit, time_budget);
+    }
+
+    bool waiting() const {
+        return gtl::event_queue<batched_event>::has_events();
+    }
+};
+
+TEST(event, evaluate, batch_limit) {
+    batched_subscriber subscriber;
+    REQUIRE(subscriber.waiting() == false, "Expected no events to be waiting.");
+
+    // Enough events are emitted that some spill into the overflow.
+    for (int index = 0; index < 1000; ++index) {
+        gtl::event_manager<batched_event>::emit(batched_event{ index });
+    }
+    REQUIRE(subscriber.waiting() == true, "Expected events to be waiting.");
+
+    unsigned long long int batches = 0;
+    while (subscriber.waiting()) {
+        REQUIRE(subscriber.process(100) <= 100, "Expected no more events than the batch limit to be processed.");
+        ++batches;
+    }
+    REQUIRE(batches == 10, "Expected the events to be processed in batches.");
+    REQUIRE(subscriber.values.size() == 1000, "Expected every event to be processed.");
+    bool ordered = true;
+    for (int index = 0; index < 1000; ++index) {
+        ordered = ordered && (subscriber.values[static_cast<unsigned long long int>(index)] == index);
+    }
+    REQUIRE(ordered, "Expected events to be processed in the order they were emitted across batches.");
+}
+
+TEST(event, evaluate, time_budget) {
+    batched_subscriber subscriber;
+
+    // Each negative event takes a couple of milliseconds to handle.
+    for (int index = 0; index < 20; ++index) {
+        gtl::event_manager<batched_event>::emit(batched_event{ -1 - index });
+    }
+
+    // The budget is checked between events, and at least one event is always processed.
+    const unsigned long long int processed = subscriber.process(1000, std::chrono::milliseconds(5));
+    REQUIRE((processed >= 1) && (processed < 20), "Expected the time budget to stop processing early.");
+    REQUIRE(subscriber.process(1000, std::chrono::milliseconds(0)) == 1, "Expected a single event to be processed without a budget.");
+    REQUIRE(subscriber.process() == 19 - processed, "Expected the remaining events to be processed.");
+}
+
+TEST(event, evaluate, reemit_while_processing) {
+    batched_subscriber subscriber;
+    subscriber.reemit = true;
+
+    // Events emitted by the handler are left for the next call rather than being processed forever.
+    gtl::event_manager<batched_event>::emit(batched_event{ 0 });
+    REQUIRE(subscriber.process() == 1, "Expected only the queued event to be processed.");
+    REQUIRE(subscriber.process() == 1, "Expected only the re-emitted event to be processed.");
+    REQUIRE(subscriber.values.size() == 2, "Expected both events to have been processed.");
+    REQUIRE(subscriber.values[1] == 1, "Expected the re-emitted event to have been processed.");
+    subscriber.reemit = false;
+    REQUIRE(subscriber.process() == 1, "Expected the final re-emitted event to be processed.");
+    REQUIRE(subscriber.waiting() == false, "Expected no events to be waiting.");
+}
+
+struct routed_event {
+    int value;
+};
+
+class routed_subscriber final
+    : private gtl::event_queue<routed_event> {
+public:
+    std::vector<int> values;
+
+private:
+    void on_event(routed_event& data) override {
+        this->values.push_back(data.value);
+    }
+
+public:
+    void topic(unsigned long long int key) {
+        gtl::event_queue<routed_event>::subscribe_topic(key);
+    }
+
+    void untopic(unsigned long long int key) {
+        gtl::event_queue<routed_event>::unsubscribe_topic(key);
+    }
+
+    void filter(gtl::event_manager<routed_event>::filter_type predicate) {
+        gtl::event_queue<routed_event>::filter_events(std::move(predicate));
+    }
+
+    void process() {
+        gtl::event_queue<routed_event>::process_events();
+    }
+};
+
+TEST(event, evaluate, topics) {
+    routed_subscriber everything;
+    routed_subscriber first;
+    routed_subscriber second;
+    first.topic(1);
+    second.topic(2);
+    second.topic(3);
+
+    const unsigned long long int delivered = gtl::event_manager<routed_event>::delivered();
+    const unsigned long long int filtered = gtl::event_manager<routed_event>::filtered();
+
+    gtl::event_manager<routed_event>::emit(1, routed_event{ 1 });
+    gtl::event_manager<routed_event>::emit(2, routed_event{ 2 });
+    gtl::event_manager<routed_event>::emit(3, routed_event{ 3 });
+    gtl::event_manager<routed_event>::emit(4, routed_event{ 4 });
+    gtl::event_manager<routed_event>::emit(routed_event{ 5 });
+    everything.process();
+    first.process();
+    second.process();
+
+    REQUIRE(everything.values == std::vector<int>({ 1, 2, 3, 4, 5 }), "Expected a subscriber without topics to receive every event.");
+    REQUIRE(first.values == std::vector<int>({ 1 }), "Expected a subscriber to only receive events of its topic.");
+    REQUIRE(second.values == std::vector<int>({ 2, 3 }), "Expected a subscriber to receive events of each of its topics.");
+    REQUIRE(gtl::event_manager<routed_event>::delivered() - delivered == 8, "Expected delivered events to be counted.");
+    REQUIRE(gtl::event_manager<routed_event>::filtered() - filtered == 7, "Expected filtered events to be counted.");
+
+    // Without any topics left a subscriber receives every event again.
+    first.untopic(1);
+    gtl::event_manager<routed_event>::emit(2, routed_event{ 6 });
+    first.process();
+    second.process();
+    REQUIRE(first.values == std::vector<int>({ 1, 6 }), "Expected a subscriber without topics to receive every event.");
+    REQUIRE(second.values == std::vector<int>({ 2, 3, 6 }), "Expected a subscriber to receive events of its topic.");
+}
+
+TEST(event, evaluate, filter) {
+    routed_subscriber even;
+    routed_subscriber large;
+    even.filter([](const routed_event& event) {
+        return (event.value % 2) == 0;
+    });
+    large.topic(7);
+    large.filter([](const routed_event& event) {
+        return event.value > 100;
+    });
+
+    const unsigned long long int filtered = gtl::event_manager<routed_event>::filtered();
+    for (int index = 0; index < 10; ++index) {
+        gtl::event_manager<routed_event>::emit(7, routed_event{ index * 50 });
+    }
+    even.process();
+    large.process();
+
+    REQUIRE(even.values.size() == 10, "Expected every even event to be received.");
+    REQUIRE(large.values == std::vector<int>({ 150, 200, 250, 300, 350, 400, 450 }), "Expected the topic and predicate to both filter events.");
+    REQUIRE(gtl::event_manager<routed_event>::filtered() - filtered == 3, "Expected filtered events to be counted.");
+
+    // Removing the predicate receives every event again.
+    even.filter(nullptr);
+    gtl::event_manager<routed_event>::emit(routed_event{ 1 });
+    even.process();
+    REQUIRE(even.values.back() == 1, "Expected an odd event once the predicate is removed.");
+}
+
+struct threaded_event {
+    int producer;
+    int value;
+};
+
+class threaded_subscriber final
+    : private gtl::event_queue<threaded_event> {
+public:
+    std::vector<int> last_values;
+    long long int total = 0;
+    int count = 0;
+    bool ordered = true;
+
+    threaded_subscriber(int producers)
+        : last_values(static_cast<unsigned long long int>(producers), -1) {
+    }
+
+private:
+    void on_event(threaded_event& data) override {
+        int& last_value = this->last_values[static_cast<unsigned long long int>(data.producer)];
+        this->ordered = this->ordered && (data.value == last_value + 1);
+        last_value = data.value;
+        this->total += data.value;
+        ++this->count;
+    }
+
+public:
+    void process() {
+        gtl::event_queue<threaded_event>::process_events();
+    }
+};
+
+TEST(event, evaluate, threads) {
+    constexpr static const int producer_count = 4;
+    constexpr static const int consumer_count = 3;
+    constexpr static const int event_count = 20000;
+
+    std::vector<std::unique_ptr<threaded_subscriber>> subscribers;
+    for (int index = 0; index < consumer_count; ++index) {
+        subscribers.emplace_back(new threaded_subscriber(producer_count));
+    }
+
+    std::atomic<int> running = { producer_count };
+    std::vector<std::thread> threads;
+    for (int producer = 0; producer < producer_count; ++producer) {
+        threads.emplace_back([producer, &running]() {
+            for (int index = 0; index < event_count; ++index) {
+                gtl::event_manager<threaded_event>::emit(threaded_event{ producer, index });
+            }
+            --running;
+        });
+    }
+    for (int consumer = 0; consumer < consumer_count; ++consumer) {
+        threads.emplace_back([consumer, &running, &subscribers]() {
+            threaded_subscriber& subscriber = *subscribers[static_cast<unsigned long long int>(consumer)];
+            while (running > 0) {
+                subscriber.process();
+            }
+            subscriber.process();
+        });
+    }
+
+    // Subscribers come and go while events are being emitted.
+    for (int index = 0; index < 100; ++index) {
+        threaded_subscriber transient(producer_count);
+        transient.process();
+    }
+
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    for (const std::unique_ptr<threaded_subscriber>& subscriber : subscribers) {
+        REQUIRE(subscriber->count == producer_count * event_count, "Expected every event to be received by every subscriber.");
+        REQUIRE(subscriber->total == static_cast<long long int>(producer_count) * (event_count - 1) * event_count / 2, "Expected every event value to be received.");
+        REQUIRE(subscriber->ordered, "Expected the events of each producer to be received in order.");
+    }
+}
+
+struct benchmark_event {
+    int value;
+};
+
+class benchmark_subscriber final
+    : private gtl::event_queue<benchmark_event> {
+public:
+    long long int total = 0;
+
+private:
+    void on_event(benchmark_event& data) override {
+        this->total += data.value;
+    }
+
+public:
+    void process() {
+        gtl::event_queue<benchmark_event>::process_events();
+    }
+};
+
+TEST(event, evaluate, benchmark) {
+    std::vector<std::unique_ptr<benchmark_subscriber>> subscribers;
+    for (int index = 0; index < 20; ++index) {
+        subscribers.emplace_back(new benchmark_subscriber());
+    }
+
+    PRINT("gtl::event_manager::emit: %f\n", testbench::benchmark([&]() {
+              // Several threads emit while another processes the subscribers.
+              std::atomic<int> running = { 4 };
+              std::vector<std::thread> producers;
+              for (int producer = 0; producer < 4; ++producer) {
+                  producers.emplace_back([&running]() {
+                      for (int index = 0; index < 5000; ++index) {
+                          gtl::event_manager<benchmark_event>::emit(benchmark_event{ index });
+                      }
+                      --running;
+                  });
+              }
+              while (running > 0) {
+                  for (const std::unique_ptr<benchmark_subscriber>& subscriber : subscribers) {
+                      subscriber->process();
+                  }
+              }
+              for (std::thread& producer : producers) {
+                  producer.join();
+              }
+              for (const std::unique_ptr<benchmark_subscriber>& subscriber : subscribers) {
+                  subscriber->process();
+              }
+          }, 10));
+
+    REQUIRE(subscribers[0]->total == subscribers[19]->total, "Expected every subscriber to receive the same events.");
+}
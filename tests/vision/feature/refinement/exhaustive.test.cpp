@@ -32,6 +32,7 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #pragma warning(pop)
 #endif
 
+#include <container/static_view>
 #include <vision/image_processing/sub_pixel_patch>
 #include <vision/match/score/ncc>
 #include <vision/match/score/ssd>
@@ -121,3 +122,50 @@ TEST(exhaustive, function, search_2d) {
     REQUIRE(testbench::is_value_approx(offset_rhs_y, 0.5f, 1E-6f));
     REQUIRE(testbench::is_value_approx(best_score_zncc, -1.0f, 1E-5f));
 }
+
+TEST(exhaustive, function, search_2d_view) {
+    constexpr static const unsigned int data_width = 8;
+    constexpr static const unsigned int data_height = 8;
+    constexpr static const unsigned char data_lhs[data_height][data_width] = {
+        { 0, 0, 0, 0, 0, 0, 0, 0 },
+        { 0, 254, 127, 0, 0, 0, 0, 0 },
+        { 0, 127, 64, 0, 0, 0, 0, 0 },
+        { 0, 0, 0, 0, 0, 0, 0, 0 },
+        { 0, 0, 0, 0, 0, 0, 0, 0 },
+        { 0, 0, 0, 0, 0, 0, 0, 0 },
+        { 0, 0, 0, 0, 0, 0, 0, 0 },
+        { 0, 0, 0, 0, 0, 0, 0, 0 }
+    };
+
+    constexpr static const unsigned char data_rhs[data_height][data_width] = {
+        { 0, 0, 0, 0, 0, 0, 0, 0 },
+        { 0, 0, 0, 0, 0, 0, 0, 0 },
+        { 0, 0, 254, 254, 0, 0, 0, 0 },
+        { 0, 0, 254, 254, 0, 0, 0, 0 },
+        { 0, 0, 0, 0, 0, 0, 0, 0 },
+        { 0, 0, 0, 0, 0, 0, 0, 0 },
+        { 0, 0, 0, 0, 0, 0, 0, 0 },
+        { 0, 0, 0, 0, 0, 0, 0, 0 }
+    };
+
+    constexpr static const unsigned int patch_width = 3;
+    constexpr static const unsigned int patch_height = 3;
+
+    const gtl::static_view<const unsigned char, data_height, data_width> image_lhs(&data_lhs[0][0]);
+    const gtl::static_view<const unsigned char, data_height, data_width> image_rhs(&data_rhs[0][0]);
+
+    float offset_rhs_x;
+    float offset_rhs_y;
+
+    // The patches are regions of the images so they are passed with the row stride of the images.
+    const float best_score_ssd = gtl::exhaustive_2d<patch_width, patch_height, &gtl::sub_pixel_patch<patch_width, patch_height, unsigned char>, &gtl::ssd<patch_width, patch_height, unsigned char, float>>(
+        image_lhs.region<patch_height, patch_width>(1, 1),
+        image_rhs.region<patch_height, patch_width>(2, 2),
+        offset_rhs_x,
+        offset_rhs_y
+    );
+
+    REQUIRE(testbench::is_value_approx(offset_rhs_x, 0.5f, 1E-6f));
+    REQUIRE(testbench::is_value_approx(offset_rhs_y, 0.5f, 1E-6f));
+    REQUIRE(testbench::is_value_approx(best_score_ssd, 0.25f, 1E-6f));
+}
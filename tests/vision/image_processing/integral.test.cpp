@@ -30,3 +30,28 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #if defined(_MSC_VER)
 #pragma warning(pop)
 #endif
+
+#include <container/static_view>
+
+TEST(integral, function, view) {
+    constexpr static const unsigned int data_width = 4;
+    constexpr static const unsigned int data_height = 3;
+    constexpr static const unsigned char data[data_height][data_width] = {
+        { 1, 2, 3, 4 },
+        { 5, 6, 7, 8 },
+        { 9, 10, 11, 12 }
+    };
+
+    int expected[data_height][data_width] = {};
+    gtl::integral(&data[0][0], data_width, data_height, data_width, &expected[0][0]);
+    REQUIRE(expected[data_height - 1][data_width - 1] == 78);
+
+    // The integral image is padded so it has a different row stride to the image.
+    int padded[data_height][data_width + 2] = {};
+    gtl::integral(gtl::static_view<const unsigned char, data_height, data_width>(&data[0][0]), gtl::static_view<int, data_height, data_width>(&padded[0][0], data_width + 2, 1));
+    for (unsigned int y = 0; y < data_height; ++y) {
+        for (unsigned int x = 0; x < data_width; ++x) {
+            REQUIRE(padded[y][x] == expected[y][x]);
+        }
+    }
+}
@@ -33,6 +33,8 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #pragma warning(pop)
 #endif
 
+#include <container/static_view>
+
 constexpr static const unsigned int data_width = 5;
 constexpr static const unsigned int data_height = 5;
 
@@ -264,3 +266,12 @@ TEST(sad, function, gradient_2d) {
     test_set(data_xy_empty, data_xy_fill, results_gradient);
     test_set(data_xy_fill, data_xy_empty, results_gradient);
 }
+
+TEST(sad, function, view) {
+    const gtl::static_view<const unsigned char, data_height, data_width> image_lhs(&data_x_fill[0][0]);
+    const gtl::static_view<const unsigned char, data_height, data_width> image_rhs(&data_xy_fill[0][0]);
+
+    const float expected = gtl::sad<3, 2>(&data_x_fill[1][2], data_width, &data_xy_fill[2][1], data_width);
+    REQUIRE(gtl::sad(image_lhs.region<2, 3>(1, 2), image_rhs.region<2, 3>(2, 1)) == expected);
+    REQUIRE(gtl::sad(image_lhs.region<2, 3>(1, 2), image_lhs.region<2, 3>(1, 2)) == 0.0f);
+}